@@ -0,0 +1,515 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CheckedInt128.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module CheckedInt128.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(CheckedInt128_RECURSES)
+#error Recursive header files inclusion detected in CheckedInt128.h
+#else // defined(CheckedInt128_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CheckedInt128_RECURSES
+
+#if !defined CheckedInt128_h
+/** Prevents repeated inclusion of headers. */
+#define CheckedInt128_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/kernel/ArithmeticConversionTraits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+#if defined(__SIZEOF_INT128__)
+/// Defined when the compiler provides 128-bit integers, hence CheckedInt128.
+#define DGTAL_HAS_INT128
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class CheckedInt128
+  /**
+     Description of class 'CheckedInt128' <p> \brief Aim: An exact
+     signed integer stored in a 128-bit integer, whose operations are
+     checked against overflow. When DGtal is built with GMP
+     (WITH_BIGINTEGER), a result that does not fit in 128 bits is
+     promoted to a BigInteger, and demoted as soon as it fits again;
+     otherwise an overflow throws std::overflow_error.
+
+     It is meant as the internal integer type of arithmetic
+     algorithms whose intermediate values exceed 64 bits but seldom
+     128 bits, like the COBA and Chord plane computers: almost all
+     operations are then done on native 128-bit integers with a
+     few extra tests, instead of allocating GMP integers. For
+     instance, COBANaivePlaneComputer requires integers of order
+     (2D^3)^2 for a diameter D: int64_t is limited to D ~ 500,
+     whereas CheckedInt128 stays on 128-bit integers up to D ~ 10^6.
+
+     @code
+     typedef COBANaivePlaneComputer< Z3, CheckedInt128 > NaivePlaneComputer;
+     @endcode
+
+     It is a model of CInteger (NumberTraits are specialized), and
+     may be used with IntegerComputer. Divisions truncate toward
+     zero as for native integers and BigInteger.
+
+     @note This class is only available when the compiler provides
+     128-bit integers (\c __int128), in which case DGTAL_HAS_INT128 is
+     defined.
+  */
+  class CheckedInt128
+  {
+  public:
+    /// The native 128-bit signed integer.
+    __extension__ typedef __int128 Int128;
+    /// The native 128-bit unsigned integer.
+    __extension__ typedef unsigned __int128 UInt128;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Default constructor (zero).
+    CheckedInt128();
+
+    /**
+       Constructor from any native integer.
+       @param value any integer value.
+    */
+    template <typename T,
+              typename = typename std::enable_if< std::is_integral<T>::value >::type >
+    CheckedInt128( T value )
+      : mySmall( static_cast<Int128>( value ) )
+    {}
+
+    /**
+       Constructor from a native 128-bit integer.
+       @param value any integer value.
+    */
+    CheckedInt128( Int128 value );
+
+#ifdef WITH_BIGINTEGER
+    /**
+       Constructor from a big integer (stored in 128 bits if it fits).
+       @param value any integer value.
+    */
+    explicit CheckedInt128( const BigInteger & value );
+#endif
+
+    /**
+       Copy constructor.
+       @param other the object to clone.
+    */
+    CheckedInt128( const CheckedInt128 & other );
+
+    /**
+       Move constructor.
+       @param other the object to move.
+    */
+    CheckedInt128( CheckedInt128 && other ) = default;
+
+    /**
+       Assignment.
+       @param other the object to copy.
+       @return a reference on 'this'.
+    */
+    CheckedInt128 & operator=( const CheckedInt128 & other );
+
+    /**
+       Move assignment.
+       @param other the object to move.
+       @return a reference on 'this'.
+    */
+    CheckedInt128 & operator=( CheckedInt128 && other ) = default;
+
+    // ----------------------- Arithmetic services ----------------------------
+  public:
+
+    /// @param other any integer. @return a reference on 'this', incremented by \a other.
+    CheckedInt128 & operator+=( const CheckedInt128 & other );
+    /// @param other any integer. @return a reference on 'this', decremented by \a other.
+    CheckedInt128 & operator-=( const CheckedInt128 & other );
+    /// @param other any integer. @return a reference on 'this', multiplied by \a other.
+    CheckedInt128 & operator*=( const CheckedInt128 & other );
+    /// @param other any non-zero integer. @return a reference on 'this', divided by \a other (truncated).
+    CheckedInt128 & operator/=( const CheckedInt128 & other );
+    /// @param other any non-zero integer. @return a reference on 'this', replaced by the remainder of its division by \a other.
+    CheckedInt128 & operator%=( const CheckedInt128 & other );
+
+    /// @return the opposite of this integer.
+    CheckedInt128 operator-() const;
+    /// @return this integer.
+    CheckedInt128 operator+() const;
+
+    /// Pre-increment. @return a reference on 'this'.
+    CheckedInt128 & operator++();
+    /// Pre-decrement. @return a reference on 'this'.
+    CheckedInt128 & operator--();
+    /// Post-increment. @return the former value.
+    CheckedInt128 operator++( int );
+    /// Post-decrement. @return the former value.
+    CheckedInt128 operator--( int );
+
+    /**
+       Three-way comparison.
+       @param other any integer.
+       @return a negative value, zero or a positive value when this
+       integer is respectively smaller, equal or greater than \a other.
+    */
+    int compare( const CheckedInt128 & other ) const;
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /// @return 'true' if the value is stored in 128 bits (always the case without GMP).
+    bool isNative() const;
+
+    /// @return the value (which must be stored in 128 bits, see isNative).
+    Int128 native() const;
+
+    /// @return -1, 0 or 1 according to the sign of this integer.
+    int sign() const;
+
+    /// @return 'true' if this integer is even.
+    bool even() const;
+
+    /// @return the nearest double to this integer.
+    double toDouble() const;
+
+    /// @return this integer converted to a 64-bit integer (modulo 2^64 when it does not fit).
+    DGtal::int64_t toInt64() const;
+
+#ifdef WITH_BIGINTEGER
+    /// @return this integer as a big integer.
+    BigInteger toBigInteger() const;
+#endif
+
+    /// @return the decimal representation of this integer.
+    std::string toString() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The value, when it is stored in 128 bits.
+    Int128 mySmall;
+#ifdef WITH_BIGINTEGER
+    /// The value when it does not fit in 128 bits, 0 otherwise.
+    std::unique_ptr<BigInteger> myBig;
+#endif
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// The operations that may overflow.
+    enum Operation { ADD, SUB, MUL, DIV, MOD };
+
+    /**
+       Computes an operation that overflows on 128 bits, or that
+       involves a big integer.
+       @param op the operation.
+       @param other the second operand.
+    */
+    void slowOperation( Operation op, const CheckedInt128 & other );
+
+    /**
+       Multiplies two native integers.
+       @param a any integer.
+       @param b any integer.
+       @param[out] r the product, when there is no overflow.
+       @return 'true' if the product overflows.
+    */
+    static bool mulOverflow( Int128 a, Int128 b, Int128 & r );
+
+#ifdef WITH_BIGINTEGER
+    /// @return 'true' if the value is stored as a big integer.
+    bool isBig() const { return myBig.get() != 0; }
+
+    /**
+       Stores a value, natively if it fits in 128 bits.
+       @param value any integer value.
+    */
+    void setBig( const BigInteger & value );
+
+    /// @param value any native integer. @return it as a big integer.
+    static BigInteger toBig( Int128 value );
+#else
+    /// @return false, the value is always native.
+    bool isBig() const { return false; }
+#endif
+
+  }; // end of class CheckedInt128
+
+  /// @param a any integer. @param b any integer. @return a+b.
+  CheckedInt128 operator+( CheckedInt128 a, const CheckedInt128 & b );
+  /// @param a any integer. @param b any integer. @return a-b.
+  CheckedInt128 operator-( CheckedInt128 a, const CheckedInt128 & b );
+  /// @param a any integer. @param b any integer. @return a*b.
+  CheckedInt128 operator*( CheckedInt128 a, const CheckedInt128 & b );
+  /// @param a any integer. @param b any non-zero integer. @return a/b (truncated).
+  CheckedInt128 operator/( CheckedInt128 a, const CheckedInt128 & b );
+  /// @param a any integer. @param b any non-zero integer. @return a%b.
+  CheckedInt128 operator%( CheckedInt128 a, const CheckedInt128 & b );
+  /// @param a any integer. @param b any integer. @return 'true' if a == b.
+  bool operator==( const CheckedInt128 & a, const CheckedInt128 & b );
+  /// @param a any integer. @param b any integer. @return 'true' if a != b.
+  bool operator!=( const CheckedInt128 & a, const CheckedInt128 & b );
+  /// @param a any integer. @param b any integer. @return 'true' if a < b.
+  bool operator<( const CheckedInt128 & a, const CheckedInt128 & b );
+  /// @param a any integer. @param b any integer. @return 'true' if a <= b.
+  bool operator<=( const CheckedInt128 & a, const CheckedInt128 & b );
+  /// @param a any integer. @param b any integer. @return 'true' if a > b.
+  bool operator>( const CheckedInt128 & a, const CheckedInt128 & b );
+  /// @param a any integer. @param b any integer. @return 'true' if a >= b.
+  bool operator>=( const CheckedInt128 & a, const CheckedInt128 & b );
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'CheckedInt128'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'CheckedInt128' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const CheckedInt128 & object );
+
+  /**
+   * Reads a decimal integer (optional sign followed by digits).
+   * @param in the input stream.
+   * @param object the integer read.
+   * @return the input stream after the reading.
+   */
+  std::istream&
+  operator>> ( std::istream & in, CheckedInt128 & object );
+
+
+  /** @brief Specialization of NumberTraitsImpl for DGtal::CheckedInt128
+   *
+   * A CheckedInt128 is bounded by 128 bits, except when GMP is
+   * available. As BigInteger, it is declared as signed and unsigned.
+   */
+  template <typename Enable>
+  struct NumberTraitsImpl<DGtal::CheckedInt128, Enable>
+  {
+    typedef TagTrue IsIntegral;     ///< A CheckedInt128 is of integral type.
+#ifdef WITH_BIGINTEGER
+    typedef TagFalse IsBounded;     ///< A CheckedInt128 is promoted to a BigInteger when needed.
+#else
+    typedef TagTrue IsBounded;      ///< A CheckedInt128 is bounded by 128 bits.
+#endif
+    typedef TagTrue IsUnsigned;     ///< A CheckedInt128 can be signed and unsigned.
+    typedef TagTrue IsSigned;       ///< A CheckedInt128 can be signed and unsigned.
+    typedef TagTrue IsSpecialized;  ///< Is that a number type with specific traits.
+
+    typedef DGtal::CheckedInt128 SignedVersion;    ///< Alias to the signed version of a CheckedInt128 (aka a CheckedInt128).
+    typedef DGtal::CheckedInt128 UnsignedVersion;  ///< Alias to the unsigned version of a CheckedInt128 (aka a CheckedInt128).
+    typedef DGtal::CheckedInt128 ReturnType;       ///< Alias to the type that should be used as return type.
+
+    /** @brief Defines a type that represents the "best" way to pass
+     *  a parameter of type T to a function.
+     */
+    typedef boost::call_traits<DGtal::CheckedInt128>::param_type ParamType;
+
+    /// Constant Zero.
+    static const DGtal::CheckedInt128 ZERO;
+
+    /// Constant One.
+    static const DGtal::CheckedInt128 ONE;
+
+    /// Return the zero of this integer.
+    static inline
+    ReturnType zero() noexcept
+    {
+      return ZERO;
+    }
+
+    /// Return the one of this integer.
+    static inline
+    ReturnType one() noexcept
+    {
+      return ONE;
+    }
+
+    /// Return the minimum value stored in 128 bits.
+    static inline
+    ReturnType min() noexcept
+    {
+      return CheckedInt128( static_cast<CheckedInt128::Int128>
+                            ( static_cast<CheckedInt128::UInt128>( 1 ) << 127 ) );
+    }
+
+    /// Return the maximum value stored in 128 bits.
+    static inline
+    ReturnType max() noexcept
+    {
+      return CheckedInt128( static_cast<CheckedInt128::Int128>
+                            ( ~static_cast<CheckedInt128::UInt128>( 0 ) >> 1 ) );
+    }
+
+    /// Return the number of significant binary digits in 128 bits.
+    static inline
+    unsigned int digits() noexcept
+    {
+      return 127;
+    }
+
+    /** @brief Return the bounding type of the number.
+     *
+     * @return BOUNDED, UNBOUNDED, or BOUND_UNKNOWN.
+     */
+    static inline
+    BoundEnum isBounded() noexcept
+    {
+#ifdef WITH_BIGINTEGER
+      return UNBOUNDED;
+#else
+      return BOUNDED;
+#endif
+    }
+
+    /** @brief Return the sign type of the number.
+     *
+     * @return SIGNED, UNSIGNED or SIGN_UNKNOWN.
+     */
+    static inline
+    SignEnum isSigned() noexcept
+    {
+      return SIGNED;
+    }
+
+    /** @brief
+     * Cast method to DGtal::int64_t (for I/O or board export uses
+     * only).
+     */
+    static inline
+    DGtal::int64_t castToInt64_t(const DGtal::CheckedInt128 & aT) noexcept
+    {
+      return aT.toInt64();
+    }
+
+    /** @brief
+     * Cast method to double (for I/O or board export uses
+     * only).
+     */
+    static inline
+    double castToDouble(const DGtal::CheckedInt128 & aT) noexcept
+    {
+      return aT.toDouble();
+    }
+
+    /** @brief Check the parity of a number.
+     *
+     * @param aT any number.
+     * @return 'true' iff the number is even.
+     */
+    static inline
+    bool even( ParamType aT ) noexcept
+    {
+      return aT.even();
+    }
+
+    /** @brief Check the parity of a number.
+     *
+     * @param aT any number.
+     * @return 'true' iff the number is odd.
+     */
+    static inline
+    bool odd( ParamType aT ) noexcept
+    {
+      return ! aT.even();
+    }
+  }; // end of class NumberTraits<DGtal::CheckedInt128>.
+
+  // Definition of the static attributes in order to allow ODR-usage.
+  template <typename Enable> const DGtal::CheckedInt128 NumberTraitsImpl<DGtal::CheckedInt128, Enable>::ZERO = 0;
+  template <typename Enable> const DGtal::CheckedInt128 NumberTraitsImpl<DGtal::CheckedInt128, Enable>::ONE  = 1;
+
+  /** @brief Specialization when first operand is a CheckedInt128.
+   *
+   * @see ArithmeticConversionTraits
+   */
+  template <typename U>
+  struct ArithmeticConversionTraits<CheckedInt128, U,
+      typename std::enable_if< std::is_integral<U>::value >::type >
+  {
+    using type = CheckedInt128;
+  };
+
+  /** @brief Specialization when second operand is a CheckedInt128.
+   *
+   * @see ArithmeticConversionTraits
+   */
+  template <typename T>
+  struct ArithmeticConversionTraits<T, CheckedInt128,
+      typename std::enable_if< std::is_integral<T>::value >::type >
+  {
+    using type = CheckedInt128;
+  };
+
+  /** @brief Specialization when both operands are CheckedInt128.
+   *
+   * @see ArithmeticConversionTraits
+   */
+  template <>
+  struct ArithmeticConversionTraits<CheckedInt128, CheckedInt128>
+  {
+    using type = CheckedInt128;
+  };
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/arithmetic/CheckedInt128.ih"
+
+#endif // defined(__SIZEOF_INT128__)
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CheckedInt128_h
+
+#undef CheckedInt128_RECURSES
+#endif // else defined(CheckedInt128_RECURSES)
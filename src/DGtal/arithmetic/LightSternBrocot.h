@@ -44,6 +44,8 @@
 // Inclusions
 #include <iostream>
 #include <vector>
+#include <deque>
+#include <mutex>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/StdRebinders.h"
 #include "DGtal/base/InputIteratorWithRankOnSequence.h"
@@ -92,6 +94,14 @@ namespace DGtal
    duplicate it. Use static method LightSternBrocot::fraction to obtain
    your fractions.
 
+   The tree is shared by all threads. Its nodes are stored in an
+   arena (a deque of nodes owned by the tree) and never move nor
+   change once created. Since descendants are found in maps, looking
+   for or creating a descendant takes the lock of the tree, so that
+   fractions may be computed concurrently. SternBrocot reads existing
+   descendants without lock and is thus preferable when many threads
+   share the tree.
+
    @tparam TInteger the integral type chosen for the fractions.
 
    @tparam TQuotient the integral type chosen for the
@@ -467,7 +477,8 @@ namespace DGtal
     ~LightSternBrocot();
 
     /**
-       @return the (only) instance of LightSternBrocot.
+       @return the (only) instance of LightSternBrocot, created on first
+       call (thread-safe) and never destroyed.
     */
     static LightSternBrocot & instance();
 
@@ -509,7 +520,8 @@ namespace DGtal
      */
     bool isValid() const;
 
-    /// The total number of fractions in the current tree.
+    /// The total number of fractions in the current tree (updated
+    /// under the lock of the tree).
     Quotient nbFractions;
 
     // ------------------------- Protected Datas ------------------------------
@@ -517,8 +529,10 @@ namespace DGtal
     // ------------------------- Private Datas --------------------------------
   private:
 
-    /// Singleton class.
-    static LightSternBrocot* singleton;
+    /// The arena storing all the nodes of the tree.
+    std::deque<Node> myNodes;
+    /// The lock taken when accessing or creating descendants.
+    std::mutex myMutex;
 
 
     // ------------------------- Datas ----------------------------------------
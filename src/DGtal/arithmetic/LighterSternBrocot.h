@@ -44,6 +44,8 @@
 // Inclusions
 #include <iostream>
 #include <vector>
+#include <deque>
+#include <mutex>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/StdRebinders.h"
 #include "DGtal/base/InputIteratorWithRankOnSequence.h"
@@ -94,6 +96,14 @@ namespace DGtal
    duplicate it. Use static method LighterSternBrocot::fraction to obtain
    your fractions.
 
+   The tree is shared by all threads. Its nodes are stored in an
+   arena (a deque of nodes owned by the tree) and never move nor
+   change once created. Since descendants are found in maps, looking
+   for or creating a descendant takes the lock of the tree, so that
+   fractions may be computed concurrently. SternBrocot reads existing
+   descendants without lock and is thus preferable when many threads
+   share the tree.
+
    @tparam TInteger the integral type chosen for the fractions.
 
    @tparam TQuotient the integral type chosen for the
@@ -493,7 +503,8 @@ namespace DGtal
     ~LighterSternBrocot();
 
     /**
-       @return the (only) instance of LighterSternBrocot.
+       @return the (only) instance of LighterSternBrocot, created on first
+       call (thread-safe) and never destroyed.
     */
     static LighterSternBrocot & instance();
 
@@ -536,7 +547,8 @@ namespace DGtal
      */
     bool isValid() const;
 
-    /// The total number of fractions in the current tree.
+    /// The total number of fractions in the current tree (updated
+    /// under the lock of the tree).
     Quotient nbFractions;
 
     // ------------------------- Protected Datas ------------------------------
@@ -544,8 +556,10 @@ namespace DGtal
     // ------------------------- Private Datas --------------------------------
   private:
 
-    /// Singleton class.
-    static LighterSternBrocot* singleton;
+    /// The arena storing all the nodes of the tree.
+    std::deque<Node> myNodes;
+    /// The lock taken when accessing or creating descendants.
+    std::mutex myMutex;
 
     Node* myOneOverZero;
     Node* myOneOverOne;
@@ -44,6 +44,9 @@
 // Inclusions
 #include <iostream>
 #include <vector>
+#include <deque>
+#include <atomic>
+#include <mutex>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/InputIteratorWithRankOnSequence.h"
 #include "DGtal/kernel/CInteger.h"
@@ -67,6 +70,13 @@ namespace DGtal
    duplicate it. Use static method SternBrocot::fraction to obtain
    your fractions.
 
+   The tree is shared by all threads. Its nodes are stored in an
+   arena (a deque of nodes owned by the tree) and never move
+   nor change once created. Descendants are published atomically and
+   created under a lock, so that fractions may be computed
+   concurrently (e.g. by multithreaded DSS recognition) while reading
+   the existing part of the tree without any lock.
+
    @tparam TInteger the integral type chosen for the fractions.
 
    @tparam TQuotient the integral type chosen for the
@@ -130,9 +140,9 @@ namespace DGtal
       /// the node that is the right ascendant.
       Node* ascendantRight;
       /// the node that is the left descendant or 0 (if none exist).
-      Node* descendantLeft;
+      std::atomic<Node*> descendantLeft;
       /// the node that is the right descendant or 0 (if none exist).
-      Node* descendantRight;
+      std::atomic<Node*> descendantRight;
       /// the node that is its inverse.
       Node* inverse;
     };
@@ -212,9 +222,11 @@ namespace DGtal
       Quotient u() const;
       /// @return its depth (1+number of coefficients of its continued fraction).
       Quotient k() const;
-      /// @return its left descendant (construct it if it does not exist yet).
+      /// @return its left descendant (construct it if it does not exist
+      /// yet, with its inverse).
       Fraction left() const;
-      /// @return its right descendant (construct it if it does not exist yet).
+      /// @return its right descendant (construct it if it does not
+      /// exist yet, as the inverse of the left descendant of its inverse).
       Fraction right() const;
       /// @return 'true' if it is an even fraction, i.e. its depth k() is even.
       bool even() const; 
@@ -412,7 +424,8 @@ namespace DGtal
     ~SternBrocot();
 
     /**
-       @return the (only) instance of SternBrocot.
+       @return the (only) instance of SternBrocot, created on first
+       call (thread-safe) and never destroyed.
     */
     static SternBrocot & instance();
 
@@ -456,15 +469,18 @@ namespace DGtal
      */
     bool isValid() const;
 
-    /// The total number of fractions in the current tree.
+    /// The total number of fractions in the current tree (updated
+    /// under the lock of the tree).
     Quotient nbFractions;
 
     // ------------------------- Protected Datas ------------------------------
   private:
     // ------------------------- Private Datas --------------------------------
   private:
-    /// Singleton class.
-    static SternBrocot* singleton;
+    /// The arena storing all the nodes of the tree.
+    std::deque<Node> myNodes;
+    /// The lock taken when creating nodes.
+    std::mutex myMutex;
 
     Node* myZeroOverOne;
     Node* myOneOverZero;
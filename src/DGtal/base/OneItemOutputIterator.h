@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <memory>
 #include "DGtal/base/Common.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -70,10 +71,7 @@ namespace DGtal
     /**
      * Default constructor.
      */
-    OneItemOutputIterator(): myItemPtr(NULL)
-    {
-      myItemPtr = new T(); 
-    }
+    OneItemOutputIterator(): myItemPtr( std::make_shared<T>() ) {}
     /**
      * Copy constructor.
      */
@@ -126,12 +124,12 @@ namespace DGtal
      * Checks the validity/consistency of the object.
      * @return 'true' if the object is valid, 'false' otherwise.
      */
-    inline bool isValid() const { return (myItemPtr != NULL); }
+    inline bool isValid() const { return (myItemPtr != nullptr); }
 
     // ------------------------- Private Datas --------------------------------
   private:
-    ///pointer that stores the last assigned item
-    T* myItemPtr; 
+    ///pointer that stores the last assigned item (shared by the copies)
+    std::shared_ptr<T> myItemPtr; 
 
   }; // end of class OneItemOutputIterator
 
@@ -0,0 +1,214 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file RingBuffer.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module RingBuffer.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(RingBuffer_RECURSES)
+#error Recursive header files inclusion detected in RingBuffer.h
+#else // defined(RingBuffer_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define RingBuffer_RECURSES
+
+#if !defined RingBuffer_h
+/** Prevents repeated inclusion of headers. */
+#define RingBuffer_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class RingBuffer
+  /**
+     Description of template class 'RingBuffer' <p> \brief Aim: A
+     first-in first-out sequence stored in one circular array, whose
+     capacity is a power of two and only grows.
+
+     Contrary to std::deque, pushing at the back and popping at the
+     front never allocate once the capacity is reached, so that a
+     queue that is emptied and filled again (e.g. the queue of a
+     breadth-first traversal) reuses the same memory. It models the
+     sequence expected by std::queue:
+
+     @code
+     typedef std::queue< int, RingBuffer< int > > Queue;
+     Queue q;
+     q.push( 3 ); q.push( 4 );
+     q.pop(); // q.front() == 4
+     @endcode
+
+     @note Popped elements are not destroyed until they are
+     overwritten, the buffer is cleared or destroyed.
+
+     @tparam TValue the type of the stored values (default and copy
+     constructible).
+   */
+  template <typename TValue>
+  class RingBuffer
+  {
+  public:
+    typedef RingBuffer<TValue> Self;
+    typedef TValue         value_type;
+    typedef std::size_t    size_type;
+    typedef TValue &       reference;
+    typedef const TValue & const_reference;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Constructor of an empty buffer.
+    /// @param capacity the initial capacity (rounded up to a power of two).
+    explicit RingBuffer( size_type capacity = 0 );
+
+    /// @return 'true' iff the buffer has no element.
+    bool empty() const
+    { return mySize == 0; }
+
+    /// @return the number of elements.
+    size_type size() const
+    { return mySize; }
+
+    /// @return the number of elements that can be stored without allocation.
+    size_type capacity() const
+    { return myData.size(); }
+
+    /// Ensures the given capacity (rounded up to a power of two).
+    /// @param capacity the required capacity.
+    void reserve( size_type capacity );
+
+    /// Removes all the elements (the capacity is kept).
+    void clear();
+
+    /// Swaps the content with another buffer.
+    /// @param other any buffer.
+    void swap( RingBuffer & other );
+
+    // ----------------------- Sequence services ------------------------------
+  public:
+
+    /// @return a reference on the first element (not empty).
+    reference front()
+    { ASSERT( ! empty() ); return myData[ myHead ]; }
+
+    /// @return a const reference on the first element (not empty).
+    const_reference front() const
+    { ASSERT( ! empty() ); return myData[ myHead ]; }
+
+    /// @return a reference on the last element (not empty).
+    reference back()
+    { ASSERT( ! empty() ); return myData[ ( myHead + mySize - 1 ) & myMask ]; }
+
+    /// @return a const reference on the last element (not empty).
+    const_reference back() const
+    { ASSERT( ! empty() ); return myData[ ( myHead + mySize - 1 ) & myMask ]; }
+
+    /// @param i any index smaller than size().
+    /// @return a reference on the \a i-th element from the front.
+    reference operator[]( size_type i )
+    { ASSERT( i < mySize ); return myData[ ( myHead + i ) & myMask ]; }
+
+    /// @param i any index smaller than size().
+    /// @return a const reference on the \a i-th element from the front.
+    const_reference operator[]( size_type i ) const
+    { ASSERT( i < mySize ); return myData[ ( myHead + i ) & myMask ]; }
+
+    /// Adds an element after the last one.
+    /// @param value the value to add.
+    void push_back( const value_type & value );
+
+    /// Adds an element after the last one.
+    /// @param value the value to move at the back.
+    void push_back( value_type && value );
+
+    /// Removes the first element (not empty).
+    void pop_front();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The circular array, whose size is zero or a power of two.
+    std::vector<TValue> myData;
+    /// The index of the first element.
+    size_type myHead;
+    /// The number of elements.
+    size_type mySize;
+    /// The size of myData minus one.
+    size_type myMask;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Doubles the capacity, the elements being moved at the beginning.
+    void grow();
+
+  }; // end of class RingBuffer
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'RingBuffer'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'RingBuffer' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const RingBuffer<TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/RingBuffer.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined RingBuffer_h
+
+#undef RingBuffer_RECURSES
+#endif // else defined(RingBuffer_RECURSES)
@@ -41,6 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <utility>
 #include "DGtal/base/Common.h"
 #include "DGtal/geometry/curves/ArithmeticalDSL.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -116,6 +118,25 @@ namespace DGtal
      */
     static DSS createSubsegment(const DSS& aDSS, const Point& aF, const Point& aL);
 
+    /**
+     * Construction of the subsegments of minimal parameters of a given
+     * DSL, for many pairs of extremities. The result is the same as
+     * calling createSubsegment(aDSL, aF, aL) for each pair, but the
+     * terms of smartCH that only depend on the DSL (steps, shift and
+     * their remainders) are computed once, and the queries are
+     * processed in parallel when DGtal is built with OpenMP
+     * (WITH_OPENMP).
+     *
+     * @param aDSL bounding DSL
+     * @param aExtremities pairs of first and last points of the subsegments
+     * @param[out] aResult the subsegments, in the order of @a aExtremities
+     *
+     * @see createSubsegment
+     */
+    static void createSubsegments(const DSL& aDSL,
+				  const std::vector< std::pair<Point,Point> >& aExtremities,
+				  std::vector<DSS>& aResult);
+
     /**
      * @brief Method that creates a DSS that is a pattern
      * or a repetition of a pattern from two input digital points,
@@ -179,6 +200,42 @@ namespace DGtal
      */
     static DSS createLeftSubsegment(const DSS& aDSS, const Point& aL);
 
+    /**
+     * Terms of smartCH that only depend on the bounding DSL (see
+     * functions::smartCH), so that they are computed once for all
+     * the subsegments of a DSL.
+     */
+    struct SmartCHTerms
+    {
+      /**
+       * Constructor.
+       * @param aDSL bounding DSL
+       */
+      SmartCHTerms(const DSL& aDSL);
+      /// first step of the DSL
+      Vector step;
+      /// remainder of step
+      Coordinate rStep;
+      /// opposite of the shift vector of the DSL
+      Vector shift;
+      /// remainder of shift
+      Coordinate rShift;
+    };
+
+    /**
+     * Construction of the subsegment of minimal parameters of a given
+     * DSL, whose terms of smartCH are already computed.
+     *
+     * @param aDSL bounding DSL
+     * @param aTerms terms of smartCH of @a aDSL
+     * @param aF first point of the subsegment
+     * @param aL last point of the subsegment
+     *
+     * @see createSubsegment createSubsegments
+     */
+    static DSS createSubsegment(const DSL& aDSL, const SmartCHTerms& aTerms,
+				const Point& aF, const Point& aL);
+
     /**
      * Returns the bezout vector (u,v) of a given
      * direction vector of slope @a aA / @a aB
@@ -41,6 +41,9 @@
 #include <iostream>
 #include <exception>
 #include <iomanip>
+#include <string>
+#include <vector>
+#include <utility>
 #include "DGtal/base/Common.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -197,6 +200,28 @@ namespace DGtal
        */
       DSLSubsegment(Number alpha, Number beta, Point &A, Point &B, Number precision = 1e-10);
 
+      /**
+       * Computes the parameters of the DSSs [AB] of the DSL 0 <= ax
+       * -by + mu < b for many pairs of points (A,B) of this DSL. The
+       * result is the same as constructing a DSLSubsegment(a,b,mu,A,B,type)
+       * for each pair, but with the Farey fan algorithm the ladder
+       * (the fractions f and g framing a/b in the Farey series of order
+       * n = B[0]-A[0]), which does not depend on A, is computed once per
+       * length n when the lengths range over fewer values than there
+       * are pairs. The queries are processed in parallel when DGtal is
+       * built with OpenMP (WITH_OPENMP).
+       * @param [in] a DSL a parameter
+       * @param [in] b DSL b parameter
+       * @param [in] mu DSL mu parameter
+       * @param [in] extremities pairs of left-most and right-most points
+       * @param [out] result the DSSs, in the order of @a extremities
+       * @param [in] type a type ("farey" or "localCH")
+       */
+      static void subsegments(Number a, Number b, Number mu,
+                              const std::vector< std::pair<Point,Point> > &extremities,
+                              std::vector<DSLSubsegment> &result,
+                              std::string type = "farey");
+
 
   protected:
       /**
@@ -210,6 +235,38 @@ namespace DGtal
       */
       void DSLSubsegmentFareyFan(Number a, Number b, Number mu, Point &A, Point &B);
 
+      /**
+       * Farey Fan algorithm for a DSS shorter than 2b, whose
+       * ladder is already known.
+       * @param a DSL a parameter
+       * @param b DSL b parameter
+       * @param mu DSL mu parameter
+       * @param A left-most point
+       * @param B right-most point
+       * @param fp numerator of the smallest fraction of the ladder
+       * @param fq denominator of the smallest fraction of the ladder
+       * @param gp numerator of the greatest fraction of the ladder
+       * @param gq denominator of the greatest fraction of the ladder
+       * @see fareyLadder
+       */
+      void DSLSubsegmentFareyFan(Number a, Number b, Number mu, Point &A, Point &B,
+                                 Integer fp, Integer fq, Integer gp, Integer gq);
+
+      /**
+       * Compute the ladder of the Farey fan of order n < 2b used to
+       * locate the point (a/b,mu/b): the fractions fp/fq <= a/b < gp/gq
+       * that are consecutive in the Farey series of order n.
+       * @param a DSL a parameter
+       * @param b DSL b parameter
+       * @param n order of the Farey fan
+       * @param [out] fp numerator of the smallest fraction of the ladder
+       * @param [out] fq denominator of the smallest fraction of the ladder
+       * @param [out] gp numerator of the greatest fraction of the ladder
+       * @param [out] gq denominator of the greatest fraction of the ladder
+       */
+      void fareyLadder(Number a, Number b, Integer n,
+                       Integer *fp, Integer *fq, Integer *gp, Integer *gq);
+
       /**
        * Function called by the constructor when the input parameters
        * are integers and the local convex hull algorithm is used.
@@ -222,8 +279,9 @@ namespace DGtal
       void DSLSubsegmentLocalCH(Number a, Number b, Number mu, Point &A, Point &B);
 
       /**
-       * Constructor.
-       * Forbidden by default (protected to avoid g++ warnings).
+       * Internal constructor of an empty subsegment (null
+       * characteristics), used by subsegments to allocate the
+       * results before computing them.
        */
       DSLSubsegment();
 
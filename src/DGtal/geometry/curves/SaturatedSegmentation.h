@@ -41,6 +41,9 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <algorithm>
+#include <vector>
+#include <iterator>
 #include "DGtal/base/Common.h"
 
 #include "DGtal/geometry/curves/SegmentComputerUtils.h"
@@ -232,6 +235,14 @@ namespace DGtal
        */
       bool  myFlagIsLast;
 
+      /**
+       * A flag equal to TRUE if the last maximal segment is the one
+       * that ends at the end of the underlying range, which is
+       * then not computed in advance (linear ranges processed up to
+       * their end), FALSE otherwise
+       */
+      bool  myFlagLastEndsRange;
+
 
 
       // ------------------------- Standard services -----------------------
@@ -388,6 +399,25 @@ namespace DGtal
        */
       void initLastMaximalSegment();
 
+      /**
+       * Checks if the last maximal segment of the segmentation is
+       * the one that ends at the end of the underlying range, which
+       * is the case when a range of iterators (not circulators) is
+       * processed up to its end. The range is then processed in one
+       * pass, only moving back by the length of the current segment
+       * (e.g. on a stream).
+       * @return 'true' in this case, 'false' otherwise.
+       */
+      bool lastEndsRange() const;
+      bool lastEndsRange(IteratorType) const;
+      bool lastEndsRange(CirculatorType) const;
+
+      /**
+       * @return 'true' if the current segment is the last maximal
+       * segment of the segmentation, 'false' otherwise.
+       */
+      bool isLastMaximalSegment() const;
+
     };
 
     //-------------------------------------------------------------------------
@@ -451,6 +481,30 @@ namespace DGtal
      */
     typename SaturatedSegmentation::SegmentComputerIterator end() const;
 
+    /**
+     * Computes all the segments of the segmentation, i.e. the ones
+     * visited from begin() to end(), in parallel (with OpenMP).
+     *
+     * The first and last maximal segments are computed as in begin().
+     * The maximal segments in between are ordered by their first
+     * element, which is at some offset from the first element of the
+     * first maximal segment. The offsets are cut into chunks of
+     * @a chunkSize elements, and each chunk computes, from the first
+     * maximal segment passing through its first element, the maximal
+     * segments that begin in the chunk. Since a maximal segment is
+     * characterized by its first element, the concatenation of the
+     * chunks is exactly the sequential result, whatever the number of
+     * threads.
+     *
+     * Iterators or circulators should be random access, so that the
+     * first element of each chunk is reached in constant time.
+     *
+     * @param[out] segments the segments of the segmentation (cleared first).
+     * @param chunkSize the number of elements of each chunk (at least 1).
+     */
+    void computeSegments( std::vector<SegmentComputer> & segments,
+                          std::size_t chunkSize = 4096 ) const;
+
 
     /**
      * Writes/Displays the object on an output stream.
@@ -0,0 +1,441 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file StreamingFreemanChain.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module StreamingFreemanChain.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(StreamingFreemanChain_RECURSES)
+#error Recursive header files inclusion detected in StreamingFreemanChain.h
+#else // defined(StreamingFreemanChain_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define StreamingFreemanChain_RECURSES
+
+#if !defined StreamingFreemanChain_h
+/** Prevents repeated inclusion of headers. */
+#define StreamingFreemanChain_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <functional>
+#include <limits>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/RingBuffer.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/SurfelNeighborhood.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class StreamingFreemanChain
+  /**
+     Description of template class 'StreamingFreemanChain' <p> \brief
+     Aim: A 4-connected digital curve given by its first point and a
+     stream of Freeman codes, which are read on demand and of which
+     only the last points are kept.
+
+     The codes come either from an input stream in the format of
+     FreemanChain::read ("x0 y0 code"), or from any function object
+     `bool(char&)` returning the next code ('0' to '3') or false when
+     the curve is over, e.g. a Boundary2DFreemanCodes which tracks
+     the boundary of a 2D shape surfel after surfel.
+
+     The points are visited by bidirectional ConstIterator. Moving an
+     iterator forward reads the codes as needed, and the points are
+     stored in a sliding window: when more than windowSize() points
+     have been read, the oldest point is forgotten. The memory is
+     thus bounded by the window whatever the length of the curve. It
+     is the user's responsability to choose a window large enough
+     for the algorithm that visits the curve. Accessing a point that
+     has left the window raises a MemoryException.
+
+     This is the case of GreedySegmentation and of the segmentation of
+     a whole range by SaturatedSegmentation, which only move back by
+     the length of the current segment: the segments may be consumed
+     while the curve is read, e.g.
+
+     @code
+     typedef StreamingFreemanChain<int> Chain;
+     typedef ArithmeticalDSSComputer<Chain::ConstIterator,int,4> SegmentComputer;
+     std::ifstream in( "contour.fc" );
+     Chain c( in, 4096 );
+     SaturatedSegmentation<SegmentComputer> seg( c.begin(), c.end(), SegmentComputer() );
+     for ( auto it = seg.begin(), itEnd = seg.end(); it != itEnd; ++it )
+       ... // uses *it
+     @endcode
+
+     Note that an end iterator is compared to another iterator by
+     trying to read the point of the other one, and that decrementing
+     an end iterator reads the whole curve.
+
+     @tparam TInteger the type of integer used for the coordinates of
+     points, a model of CInteger.
+  */
+  template <typename TInteger>
+  class StreamingFreemanChain
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CInteger<TInteger> ) );
+
+  public:
+    typedef StreamingFreemanChain<TInteger> Self;
+    typedef TInteger Integer;
+    typedef PointVector<2,Integer> Point;
+    typedef PointVector<2,Integer> Vector;
+    typedef std::size_t Size;
+    typedef std::size_t Index;
+    /// Type of the function objects providing the codes.
+    typedef std::function< bool( char & ) > CodeSource;
+
+    /// The default number of points kept in memory.
+    static const Size DefaultWindowSize = 65536;
+
+    /**
+       Bidirectional iterator on the points of a StreamingFreemanChain,
+       given by value.
+    */
+    class ConstIterator :
+      public std::iterator<std::bidirectional_iterator_tag, Point, std::ptrdiff_t, Point*, Point>
+    {
+    public:
+      /// Default constructor. The iterator is not valid.
+      ConstIterator()
+        : myChain( 0 ), myPos( 0 )
+      {}
+
+      /**
+         Constructor.
+         @param aChain the visited curve.
+         @param pos the index of the point (or the end index).
+      */
+      ConstIterator( const StreamingFreemanChain * aChain, Index pos )
+        : myChain( aChain ), myPos( pos )
+      {}
+
+      /// @return the current point (in the window).
+      Point operator*() const
+      { return myChain->point( myPos ); }
+
+      /// @return the index of the current point in the curve.
+      Index position() const
+      { return myPos; }
+
+      /// Pre-increment.
+      ConstIterator & operator++()
+      { ++myPos; return *this; }
+
+      /// Post-increment.
+      ConstIterator operator++( int )
+      { ConstIterator tmp( *this ); ++myPos; return tmp; }
+
+      /// Pre-decrement (reads the whole curve if this is an end iterator).
+      ConstIterator & operator--()
+      {
+        if ( myPos == StreamingFreemanChain::EndIndex
+             || ! myChain->fetch( myPos ) )
+          myPos = myChain->size();
+        --myPos;
+        return *this;
+      }
+
+      /// Post-decrement.
+      ConstIterator operator--( int )
+      { ConstIterator tmp( *this ); --( *this ); return tmp; }
+
+      /**
+         @param other any iterator on the same curve.
+         @return 'true' if both iterators point to the same point or
+         are both past the last point.
+      */
+      bool operator==( const ConstIterator & other ) const
+      {
+        return ( myChain == other.myChain )
+          && ( normalizedPosition() == other.normalizedPosition() );
+      }
+
+      /**
+         @param other any iterator on the same curve.
+         @return the negation of operator==.
+      */
+      bool operator!=( const ConstIterator & other ) const
+      { return ! ( *this == other ); }
+
+    private:
+      /// The visited curve.
+      const StreamingFreemanChain * myChain;
+      /// The index of the current point.
+      Index myPos;
+
+      /// @return the index of the point, or EndIndex if it is past the end.
+      Index normalizedPosition() const
+      {
+        return ( myPos != StreamingFreemanChain::EndIndex
+                 && myChain != 0 && myChain->fetch( myPos ) )
+          ? myPos : StreamingFreemanChain::EndIndex;
+      }
+    };
+
+    /// The position of end iterators.
+    static const Index EndIndex = std::numeric_limits<Index>::max();
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor from an input stream in the format of
+       FreemanChain::read: the lines starting with '#' are skipped,
+       then the coordinates of the first point are read, the codes
+       being read on demand up to the end of the line.
+
+       @param in any input stream, which must outlive this object.
+       @param windowSize the number of points kept in memory (at least 2).
+       @throw InputException if the first point cannot be read.
+    */
+    StreamingFreemanChain( std::istream & in,
+                           Size windowSize = DefaultWindowSize );
+
+    /**
+       Constructor from a first point and a function object providing
+       the codes.
+
+       @param firstPoint the first point of the curve.
+       @param source any function object such that `source( c )`
+       returns false when the curve is over and otherwise writes in \a c
+       the next Freeman code ('0' to '3').
+       @param windowSize the number of points kept in memory (at least 2).
+    */
+    StreamingFreemanChain( const Point & firstPoint,
+                           const CodeSource & source,
+                           Size windowSize = DefaultWindowSize );
+
+    /// Destructor.
+    ~StreamingFreemanChain() = default;
+
+    /// Copy constructor. Deleted, since iterators refer to this object.
+    StreamingFreemanChain( const StreamingFreemanChain & other ) = delete;
+
+    /// Assignment. Deleted, since iterators refer to this object.
+    StreamingFreemanChain & operator=( const StreamingFreemanChain & other ) = delete;
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /// @return an iterator on the first point.
+    ConstIterator begin() const;
+
+    /// @return an iterator past the last point.
+    ConstIterator end() const;
+
+    /// @return the first point of the curve.
+    const Point & firstPoint() const;
+
+    /// @return the maximal number of points kept in memory.
+    Size windowSize() const;
+
+    /// @return the number of points read so far.
+    Size nbReadPoints() const;
+
+    /// @return the index of the oldest point still in memory.
+    Index firstAvailableIndex() const;
+
+    /// @return 'true' if all the codes have been read.
+    bool isExhausted() const;
+
+    /**
+       Reads the whole curve (only the last points are kept).
+       @return the number of points of the curve (number of codes + 1).
+    */
+    Size size() const;
+
+    /**
+       Reads the codes until the point of index \a i is known.
+       @param i any index.
+       @return 'true' if the curve has a point of index \a i.
+    */
+    bool fetch( Index i ) const;
+
+    /**
+       @param i the index of a point of the curve.
+       @return the point of index \a i.
+       @throw MemoryException if this point has left the window.
+    */
+    Point point( Index i ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// Reads the codes of a line of an input stream.
+    struct StreamCodeSource
+    {
+      std::istream * myIn;
+      bool myStarted;
+      bool operator()( char & code );
+    };
+
+    /// The function object providing the codes.
+    mutable CodeSource mySource;
+    /// The first point.
+    Point myFirstPoint;
+    /// The maximal number of points in memory.
+    Size myWindowSize;
+    /// The last points read.
+    mutable RingBuffer<Point> myWindow;
+    /// The index of the first point of myWindow.
+    mutable Index myFirstIndex;
+    /// 'true' when the source has no more codes.
+    mutable bool myExhausted;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Reads the next code, if any, and updates the window.
+    void readNext() const;
+
+  }; // end of class StreamingFreemanChain
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class Boundary2DFreemanCodes
+  /**
+     Description of template class 'Boundary2DFreemanCodes' <p>
+     \brief Aim: A function object providing one by one the Freeman
+     codes of the boundary of a 2D shape, by tracking its surfels
+     like Surfaces::track2DBoundary, but without storing them. It is
+     meant as a code source of StreamingFreemanChain.
+
+     The surfels are visited in the direct orientation from the start
+     surfel, and each surfel gives the code from its indirect to its
+     direct incident pointel, so that the points of the curve are the
+     points of Surfaces::track2DBoundaryPoints, starting from the
+     start surfel. The tracking stops when the start surfel is met
+     again (closed boundary, whose last point is the first one) or
+     when there is no next surfel (open boundary, which should then
+     be started from its first surfel).
+
+     @code
+     Boundary2DFreemanCodes<KSpace,Predicate> codes( K, sAdj, pred, start );
+     StreamingFreemanChain<KSpace::Integer> c( codes.firstPoint(), codes );
+     @endcode
+
+     @tparam TKSpace any 2D model of CCellularGridSpaceND.
+     @tparam TPointPredicate any model of CPointPredicate.
+  */
+  template <typename TKSpace, typename TPointPredicate>
+  class Boundary2DFreemanCodes
+  {
+    BOOST_STATIC_ASSERT(( TKSpace::dimension == 2 ));
+
+  public:
+    typedef TKSpace KSpace;
+    typedef TPointPredicate PointPredicate;
+    typedef typename KSpace::SCell SCell;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::Integer Integer;
+    typedef SurfelAdjacency<KSpace::dimension> Adjacency;
+
+    /**
+       Constructor.
+       @param K the cellular space, which must outlive this object.
+       @param surfelAdj the surfel adjacency, which must outlive this object.
+       @param pp the shape, which must outlive this object.
+       @param startSurfel any surfel of the boundary.
+    */
+    Boundary2DFreemanCodes( ConstAlias<KSpace> K,
+                            ConstAlias<Adjacency> surfelAdj,
+                            ConstAlias<PointPredicate> pp,
+                            const SCell & startSurfel );
+
+    /// @return the first point of the curve (a pointel of the start surfel).
+    Point firstPoint() const;
+
+    /**
+       Goes to the next surfel.
+       @param[out] code the Freeman code of the current surfel.
+       @return false if the tracking is over, 'true' otherwise.
+    */
+    bool operator()( char & code );
+
+  private:
+    /// The cellular space.
+    const KSpace * myK;
+    /// The shape.
+    const PointPredicate * myPP;
+    /// The surfel neighborhood used for tracking.
+    SurfelNeighborhood<KSpace> myNeighborhood;
+    /// The start surfel.
+    SCell myStart;
+    /// The current surfel.
+    SCell myCurrent;
+    /// 'true' when all the surfels have been visited.
+    bool myFinished;
+
+  }; // end of class Boundary2DFreemanCodes
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'StreamingFreemanChain'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'StreamingFreemanChain' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TInteger>
+  std::ostream&
+  operator<< ( std::ostream & out, const StreamingFreemanChain<TInteger> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/StreamingFreemanChain.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined StreamingFreemanChain_h
+
+#undef StreamingFreemanChain_RECURSES
+#endif // else defined(StreamingFreemanChain_RECURSES)
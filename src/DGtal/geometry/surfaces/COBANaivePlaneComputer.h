@@ -94,7 +94,8 @@ namespace DGtal
    * Note on execution times: The user should favor int64_t instead of
    * BigInteger whenever possible (diameter smaller than 500). The
    * speed-up is between 10 and 20 for these diameters. For greater
-   * diameters, it is necessary to use BigInteger (see below).
+   * diameters, CheckedInt128 keeps most of the speed of native
+   * integers and falls back to BigInteger only on overflow (see below).
    *
    * @tparam TSpace specifies the type of digital space in which lies
    * input digital points. A model of CSpace.
@@ -103,9 +104,11 @@ namespace DGtal
    * internal computations. The type should be able to hold integers
    * of order (2*D^3)^2 if D is the diameter of the set of digital
    * points. In practice, diameter is limited to 20 for int32_t,
-   * diameter is approximately 500 for int64_t, and whatever with
-   * BigInteger/GMP integers. For huge diameters, the slow-down is
-   * polylogarithmic with respect to the diameter.
+   * diameter is approximately 500 for int64_t, approximately 10^6 for
+   * CheckedInt128 when DGtal is not built with GMP, and whatever with
+   * BigInteger/GMP integers or CheckedInt128 with GMP. For huge
+   * diameters, the slow-down is polylogarithmic with respect to the
+   * diameter.
    *
    * Essentially a backport from ImaGene.
    *
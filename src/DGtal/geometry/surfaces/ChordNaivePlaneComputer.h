@@ -90,7 +90,7 @@ namespace DGtal
    *  components are smaller than 14000, int32_t are sufficient. For
    *  point components smaller than 440000000, int64_t are
    *  sufficient. For greater diameters, it is necessary to use
-   *  BigInteger.
+   *  CheckedInt128 (with int64_t points), or BigInteger.
 
    * \par What is the best algorithm to check if a set of digital points is some (naive) plane ?
 
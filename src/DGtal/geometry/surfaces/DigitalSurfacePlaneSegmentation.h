@@ -0,0 +1,275 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSurfacePlaneSegmentation.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module DigitalSurfacePlaneSegmentation.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSurfacePlaneSegmentation_RECURSES)
+#error Recursive header files inclusion detected in DigitalSurfacePlaneSegmentation.h
+#else // defined(DigitalSurfacePlaneSegmentation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSurfacePlaneSegmentation_RECURSES
+
+#if !defined DigitalSurfacePlaneSegmentation_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSurfacePlaneSegmentation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+#include "DGtal/topology/CompressedSurfelGraph.h"
+#include "DGtal/geometry/surfaces/CAdditivePrimitiveComputer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSurfacePlaneSegmentation
+  /**
+   * Description of template class 'DigitalSurfacePlaneSegmentation'
+   * <p> \brief Aim: Segments a whole digital surface into pieces of
+   * digital planes, by greedy plane growing.
+   *
+   * Surfels are taken as seeds in increasing order. From each surfel
+   * not yet in a plane, a plane is grown by a breadth-first traversal
+   * of the surfel adjacency graph: each visited surfel not yet in a
+   * plane is added to the plane if its point (the direct incident
+   * pointel along its orthogonal direction, as in \ref
+   * moduleCOBANaivePlaneRecognition_sec5) can extend it, and the
+   * traversal then continues through its neighbors; otherwise the
+   * surfel is ignored. The result is a plane index for every surfel,
+   * and the parameters (unit normal and bounds) of every plane.
+   *
+   * The surface is first frozen into a CompressedSurfelGraph, so any
+   * surface giving access to a digital surface container through
+   * `container()` (DigitalSurface, IndexedDigitalSurface) can be
+   * segmented.
+   *
+   * Planes are grown in parallel when DGtal is built with OpenMP
+   * (WITH_OPENMP): at each round, one plane is grown from each of the
+   * next \a batchSize seeds, against a shared bitmap of the surfels
+   * already claimed by a plane. The grown planes are then accepted in
+   * the order of their seeds, skipping planes whose seed has been
+   * claimed in the meantime, and stopping at the first plane that
+   * overlaps a plane accepted during the round. Such an accepted plane
+   * is exactly the one the sequential algorithm grows from the same
+   * seed, hence the segmentation does not depend on the number of
+   * threads nor on the batch size.
+   *
+   * @code
+   * typedef COBAGenericNaivePlaneComputer< Z3i::Space, DGtal::int64_t > PlaneComputer;
+   * PlaneComputer prototype;
+   * prototype.init( 500, 1, 1 ); // diameter, width 1/1
+   * DigitalSurfacePlaneSegmentation< Z3i::KSpace, PlaneComputer > segmentation( prototype );
+   * segmentation.compute( surface );
+   * for ( auto s : surface )
+   *   std::cout << s << " in plane " << segmentation.planeIndex( s ) << std::endl;
+   * @endcode
+   *
+   * @tparam TKSpace the type of cellular grid space of the surfaces
+   * (a 3D KhalimskySpaceND), a model of CCellularGridSpaceND.
+   *
+   * @tparam TPlaneComputer the type of plane recognition algorithm,
+   * a model of CAdditivePrimitiveComputer that recognizes planes in
+   * any direction and provides getUnitNormal and getBounds (e.g.
+   * COBAGenericNaivePlaneComputer, ChordGenericNaivePlaneComputer).
+   */
+  template <typename TKSpace, typename TPlaneComputer>
+  class DigitalSurfacePlaneSegmentation
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< TKSpace > ));
+    BOOST_CONCEPT_ASSERT(( concepts::CAdditivePrimitiveComputer< TPlaneComputer > ));
+    BOOST_STATIC_ASSERT(( TKSpace::dimension == 3 ));
+
+  public:
+    typedef DigitalSurfacePlaneSegmentation<TKSpace, TPlaneComputer> Self;
+    typedef TKSpace                               KSpace;
+    typedef TPlaneComputer                        PlaneComputer;
+    typedef typename PlaneComputer::Point         Point;
+    typedef typename KSpace::Space::RealVector    RealVector;
+    typedef typename KSpace::Surfel               Surfel;
+    typedef CompressedSurfelGraph<KSpace>         Graph;
+    typedef typename Graph::Index                 Index;
+    typedef typename Graph::Vertex                Vertex;
+    typedef typename Graph::Size                  Size;
+
+    /// A plane of the segmentation, the points \a x of its surfels
+    /// satisfy min <= normal.x <= max.
+    struct Plane
+    {
+      Vertex     seed;   ///< the vertex from which the plane was grown.
+      Size       size;   ///< the number of surfels of the plane.
+      RealVector normal; ///< the unit normal vector of the plane.
+      double     min;    ///< the lower bound of the plane.
+      double     max;    ///< the upper bound of the plane.
+    };
+    typedef std::vector<Plane>                    PlaneStorage;
+
+    /// The plane index of surfels not yet in a plane.
+    static const Index InvalidIndex = Graph::InvalidIndex;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param prototype an initialized plane computer (e.g. with its
+     * diameter and width), copied for each plane.
+     *
+     * @param batchSize the number of planes grown at each round
+     * (0 is 64 when DGtal is built with OpenMP, 1 otherwise). It has
+     * no influence on the result.
+     */
+    DigitalSurfacePlaneSegmentation( const PlaneComputer & prototype,
+                                     Size batchSize = 0 );
+
+    /**
+     * Segments the given surface into pieces of digital planes.
+     *
+     * @tparam TDigitalSurface any type of surface with a method
+     * `container()` returning a model of CDigitalSurfaceContainer
+     * (e.g. DigitalSurface, IndexedDigitalSurface).
+     *
+     * @param surface the digital surface to segment.
+     */
+    template <typename TDigitalSurface>
+    void compute( const TDigitalSurface & surface );
+
+    /// @return the surfel adjacency graph of the last segmented surface.
+    const Graph & graph() const
+    { return myGraph; }
+
+    /// @return the number of planes of the segmentation.
+    Size nbPlanes() const
+    { return (Size) myPlanes.size(); }
+
+    /// @return the planes of the segmentation, in the order of their seeds.
+    const PlaneStorage & planes() const
+    { return myPlanes; }
+
+    /// @return the plane index of each vertex of graph().
+    const std::vector<Index> & planeIndices() const
+    { return myPlaneIndices; }
+
+    /**
+     * @param v any vertex of graph().
+     * @return the index of the plane containing \a v.
+     */
+    Index planeIndex( const Vertex & v ) const
+    { return myPlaneIndices[ v ]; }
+
+    /**
+     * @param s any surfel of the last segmented surface.
+     * @return the index of the plane containing \a s.
+     */
+    Index planeIndex( const Surfel & s ) const
+    { return myPlaneIndices[ myGraph.index( s ) ]; }
+
+    /**
+     * @param v any vertex of graph().
+     * @return the point of \a v given to the plane computers.
+     */
+    const Point & point( const Vertex & v ) const
+    { return myPoints[ v ]; }
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if every surfel is in a plane.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// The initialized plane computer, copied for each plane.
+    PlaneComputer myPrototype;
+    /// The number of planes grown at each round.
+    Size myBatchSize;
+    /// The surfel adjacency graph of the segmented surface.
+    Graph myGraph;
+    /// The point of each vertex given to the plane computers.
+    std::vector<Point> myPoints;
+    /// The plane index of each vertex.
+    std::vector<Index> myPlaneIndices;
+    /// The planes of the segmentation.
+    PlaneStorage myPlanes;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Grows a plane from a seed by breadth-first traversal, ignoring
+     * claimed vertices.
+     *
+     * @param[in] seed the vertex from which the plane is grown.
+     * @param[in] claimed the vertices already in a plane.
+     * @param[out] plane the recognized plane.
+     * @param[out] vertices the vertices of the plane, in traversal order.
+     */
+    void growPlane( Vertex seed, const std::vector<bool> & claimed,
+                    PlaneComputer & plane, std::vector<Vertex> & vertices ) const;
+
+  }; // end of class DigitalSurfacePlaneSegmentation
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSurfacePlaneSegmentation'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSurfacePlaneSegmentation' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace, typename TPlaneComputer>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const DigitalSurfacePlaneSegmentation<TKSpace, TPlaneComputer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/DigitalSurfacePlaneSegmentation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSurfacePlaneSegmentation_h
+
+#undef DigitalSurfacePlaneSegmentation_RECURSES
+#endif // else defined(DigitalSurfacePlaneSegmentation_RECURSES)
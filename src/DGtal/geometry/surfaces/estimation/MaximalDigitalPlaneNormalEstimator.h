@@ -0,0 +1,335 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MaximalDigitalPlaneNormalEstimator.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module MaximalDigitalPlaneNormalEstimator.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MaximalDigitalPlaneNormalEstimator_RECURSES)
+#error Recursive header files inclusion detected in MaximalDigitalPlaneNormalEstimator.h
+#else // defined(MaximalDigitalPlaneNormalEstimator_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MaximalDigitalPlaneNormalEstimator_RECURSES
+
+#if !defined MaximalDigitalPlaneNormalEstimator_h
+/** Prevents repeated inclusion of headers. */
+#define MaximalDigitalPlaneNormalEstimator_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <unordered_set>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CountedConstPtrOrConstPtr.h"
+#include "DGtal/topology/CDigitalSurfaceContainer.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/CompressedSurfelGraph.h"
+#include "DGtal/geometry/surfaces/CAdditivePrimitiveComputer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MaximalDigitalPlaneNormalEstimator
+  /**
+   * Description of template class 'MaximalDigitalPlaneNormalEstimator' <p>
+   * \brief Aim: Estimates the normal vector of each surfel of a
+   * digital surface as the normal of the largest digital plane
+   * centered on it. It is a model of CDigitalSurfaceLocalEstimator.
+   *
+   * The ball of radius \a k around a surfel \a t is the set of surfels
+   * at distance at most \a k from \a t in the surfel adjacency graph.
+   * The radius \a r(t) of \a t is the greatest \a k no greater than
+   * the maximal radius such that the points of the surfels of the ball
+   * (the direct incident pointels along their orthogonal direction, as
+   * in \ref moduleCOBANaivePlaneRecognition_sec5) are recognized as a
+   * digital plane by the plane computer. The estimated normal of \a t
+   * is the unit normal of the plane recognized from the ball of radius
+   * \a r(t), oriented outward like the trivial normal of \a t.
+   *
+   * Since balls of adjacent surfels \a t and \a n are nested, \a
+   * r(n)-1 <= r(t) <= r(n)+1. Surfels are thus processed in
+   * breadth-first order, by chunks, and the radius of a surfel is
+   * searched between the bounds given by its neighbors already
+   * processed in the same chunk: the plane computer is extended with
+   * the ball of the lower bound at once, then ring by ring, which
+   * tests at most two rings instead of all the rings from the
+   * surfel. The result is the same as the one of an independent
+   * computation at each surfel, for any chunking. Chunks are processed
+   * in parallel when DGtal is built with OpenMP (WITH_OPENMP).
+   *
+   * All the normals are computed by \ref init on the whole surface,
+   * \ref eval only reads them.
+   *
+   * @code
+   * typedef COBAGenericNaivePlaneComputer< Z3i::Space, DGtal::int64_t > PlaneComputer;
+   * typedef MaximalDigitalPlaneNormalEstimator< Container, PlaneComputer > Estimator;
+   * PlaneComputer prototype;
+   * prototype.init( 100, 1, 1 ); // diameter, width 1/1
+   * Estimator estimator( surface );
+   * estimator.setParams( prototype, 8 ); // maximal radius
+   * estimator.init( 1.0, surface.begin(), surface.end() );
+   * std::vector< Estimator::Quantity > normals;
+   * estimator.eval( surface.begin(), surface.end(), std::back_inserter( normals ) );
+   * @endcode
+   *
+   * @tparam TDigitalSurfaceContainer the type of digital surface
+   * container (model of CDigitalSurfaceContainer) in a 3D space.
+   *
+   * @tparam TPlaneComputer the type of plane recognition algorithm,
+   * a model of CAdditivePrimitiveComputer that recognizes planes in
+   * any direction and provides getUnitNormal (e.g.
+   * COBAGenericNaivePlaneComputer, ChordGenericNaivePlaneComputer).
+   */
+  template <typename TDigitalSurfaceContainer, typename TPlaneComputer>
+  class MaximalDigitalPlaneNormalEstimator
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CDigitalSurfaceContainer< TDigitalSurfaceContainer > ));
+    BOOST_CONCEPT_ASSERT(( concepts::CAdditivePrimitiveComputer< TPlaneComputer > ));
+    BOOST_STATIC_ASSERT(( TDigitalSurfaceContainer::KSpace::dimension == 3 ));
+
+    // ----------------------- public types ------------------------------
+  public:
+    typedef MaximalDigitalPlaneNormalEstimator<TDigitalSurfaceContainer, TPlaneComputer> Self;
+    typedef TDigitalSurfaceContainer DigitalSurfaceContainer; ///< the chosen container
+    typedef TPlaneComputer                     PlaneComputer; ///< the plane recognition algorithm
+    typedef DigitalSurface<DigitalSurfaceContainer> Surface; ///< the digital surface
+    typedef typename DigitalSurfaceContainer::KSpace  KSpace; ///< the cellular grid space
+    typedef typename KSpace::Space::RealVector    RealVector; ///< the real vector type
+
+    // ----------------------- model of CDigitalSurfaceLocalEstimator ----------------
+    typedef typename Surface::Surfel                  Surfel; ///< the signed surface element
+    typedef RealVector                              Quantity; ///< the estimated outward unit normal
+    // -----------------------               other types         -----------------------
+    typedef typename Surface::SCell                    SCell; ///< the signed cell
+    typedef typename PlaneComputer::Point              Point; ///< the points given to the plane computers
+    typedef double                                    Scalar; ///< the "real number" type
+    typedef CompressedSurfelGraph<KSpace>              Graph; ///< the surfel adjacency graph
+    typedef typename Graph::Vertex                    Vertex; ///< a vertex of the graph
+    typedef typename Graph::Size                        Size; ///< the number of vertices
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor. The estimator is invalid and \ref attach
+     * and \ref setParams \b must be called.
+     */
+    MaximalDigitalPlaneNormalEstimator();
+
+    /**
+     * Constructor. The estimator is invalid and \ref setParams \b must
+     * be called.
+     *
+     * @param surface the digital surface that is aliased in this. The
+     * user can \b secure the aliasing by passing a
+     * CountedConstPtrOrConstPtr.
+     */
+    MaximalDigitalPlaneNormalEstimator( ConstAlias< Surface > surface );
+
+    /**
+     * Attach a digital surface. After this call, the normals must be
+     * computed again with \ref init.
+     *
+     * @param surface the digital surface that is aliased in this. The
+     * user can \b secure the aliasing by passing a
+     * CountedConstPtrOrConstPtr.
+     */
+    void attach( ConstAlias<Surface> surface );
+
+    /**
+     * Initialisation of estimator specific parameters.
+     *
+     * @param[in] prototype an initialized plane computer (e.g. with its
+     * diameter and width), copied for each surfel. Its diameter must
+     * contain the balls of radius \a maxRadius.
+     *
+     * @param[in] maxRadius the maximal radius of the balls of surfels.
+     */
+    void setParams( const PlaneComputer & prototype, unsigned int maxRadius = 10 );
+
+    /**
+     * Model of CDigitalSurfaceLocalEstimator. Initialisation. Computes
+     * the normals of all the surfels of the attached surface, the
+     * range [itb,ite) is not used.
+     *
+     * @tparam SurfelConstIterator any model of forward readable iterator on Surfel.
+     * @param[in] _h grid size (must be >0), only stored.
+     * @param[in] itb iterator on the first surfel of the surface.
+     * @param[in] ite iterator after the last surfel of the surface.
+     */
+    template <typename SurfelConstIterator>
+    void init( const Scalar _h,
+               SurfelConstIterator itb,
+               SurfelConstIterator ite );
+
+    /**
+     * @tparam SurfelConstIterator any model of forward readable iterator on Surfel.
+     * @param [in] it the surfel iterator at which we evaluate the quantity.
+     * @return the estimated quantity at *it
+     */
+    template <typename SurfelConstIterator>
+    Quantity eval( SurfelConstIterator it ) const;
+
+    /**
+     * @return the estimated quantity in the range [itb,ite)
+     * @param [in] itb starting surfel iterator.
+     * @param [in] ite end surfel iterator.
+     * @param [in,out] result resulting output iterator
+     */
+    template <typename SurfelConstIterator,typename OutputIterator>
+    OutputIterator eval( SurfelConstIterator itb,
+                         SurfelConstIterator ite,
+                         OutputIterator result ) const;
+
+    /**
+       @return the gridstep.
+       @pre must be called after init
+    */
+    Scalar h() const;
+
+    /**
+     * @param s any surfel of the surface.
+     * @return the radius of the largest ball around \a s recognized as a plane.
+     * @pre must be called after init
+     */
+    unsigned int radius( const Surfel & s ) const;
+
+    /// @return the surfel adjacency graph built by the last \ref init.
+    const Graph & graph() const
+    { return myGraph; }
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the normals have been computed.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// A (possibly) shared object storing the digital surface.
+    CountedConstPtrOrConstPtr<Surface> mySurface;
+    /// The initialized plane computer, copied for each surfel.
+    PlaneComputer myPrototype;
+    /// The maximal radius of the balls.
+    unsigned int myMaxRadius;
+    /// The gridstep
+    Scalar myH;
+    /// The surfel adjacency graph of the surface.
+    Graph myGraph;
+    /// The point of each vertex given to the plane computers.
+    std::vector<Point> myPoints;
+    /// The radius of each vertex.
+    std::vector<unsigned int> myRadii;
+    /// The estimated normal of each vertex.
+    std::vector<Quantity> myNormals;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /// The ball of a vertex, stored ring by ring in breadth-first order.
+    struct Ball
+    {
+      std::vector<Vertex> vertices;    ///< the vertices, ring by ring.
+      std::vector<std::size_t> rings;  ///< the end of each ring in vertices.
+      std::unordered_set<Vertex> visited; ///< the vertices of the ball.
+      std::vector<Point> points;       ///< a buffer for the points of a ring.
+    };
+
+    /**
+     * Computes the radius and the normal of a vertex, knowing that its
+     * radius lies in [\a lower, \a upper].
+     *
+     * @param[in] v the vertex.
+     * @param[in] lower a lower bound of the radius of \a v.
+     * @param[in] upper an upper bound of the radius of \a v.
+     * @param[in,out] ball a buffer for the ball of \a v.
+     */
+    void computeNormal( Vertex v, unsigned int lower, unsigned int upper,
+                        Ball & ball );
+
+    /**
+     * Extends a ball up to the given radius, or until it contains its
+     * whole connected component.
+     *
+     * @param[in,out] ball the ball.
+     * @param[in] radius the requested radius.
+     * @return 'true' if the ball has radius \a radius, 'false' if it
+     * is its whole connected component with a smaller radius.
+     */
+    bool growBall( Ball & ball, unsigned int radius ) const;
+
+    /**
+     * Extends a plane computer with the points of the vertices of a ball
+     * between two positions.
+     *
+     * @param[in,out] plane the plane computer.
+     * @param[in,out] ball the ball.
+     * @param[in] first the position of the first vertex in the ball.
+     * @param[in] last the position after the last vertex in the ball.
+     * @return 'true' if it is still a plane.
+     */
+    bool extend( PlaneComputer & plane, Ball & ball,
+                 std::size_t first, std::size_t last ) const;
+
+  }; // end of class MaximalDigitalPlaneNormalEstimator
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MaximalDigitalPlaneNormalEstimator'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MaximalDigitalPlaneNormalEstimator' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDigitalSurfaceContainer, typename TPlaneComputer>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const MaximalDigitalPlaneNormalEstimator<TDigitalSurfaceContainer, TPlaneComputer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/estimation/MaximalDigitalPlaneNormalEstimator.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MaximalDigitalPlaneNormalEstimator_h
+
+#undef MaximalDigitalPlaneNormalEstimator_RECURSES
+#endif // else defined(MaximalDigitalPlaneNormalEstimator_RECURSES)
@@ -357,6 +357,54 @@ namespace DGtal
 				   OutputIterator res, 
 				   const Predicate& aPredicate ); 
 
+    /**
+     * @brief Procedure that retrieves the vertices
+     * of the convex hull of a set of 2D points given by
+     * the range [ @a itb , @a ite ), by divide and conquer.
+     * - the points strictly inside the octagon whose vertices are
+     * extremal in the directions of the axes and of the diagonals are
+     * discarded [Akl and Toussaint, 1978], by testing whole ranges of
+     * points against each edge of the octagon with the range operator
+     * of the orientation functor.
+     * - the points are cut into chunks of @a chunkSize points, whose
+     * remaining points are reduced to their convex hull vertices by
+     * Hull2D::andrewConvexHullAlgorithm. Chunks are processed in
+     * parallel when DGtal is built with OpenMP (WITH_OPENMP), each with
+     * its own copy of the orientation functor.
+     * - the vertices of all chunk hulls, sorted along the horizontal
+     * axis, form a simple polygonal line, whose convex hull is computed
+     * by Hull2D::melkmanConvexHullAlgorithm.
+     * @see Hull2D::andrewConvexHullAlgorithm Hull2D::melkmanConvexHullAlgorithm
+     *
+     * @post The extremal points are counter-clockwise oriented, as
+     * returned by Hull2D::melkmanConvexHullAlgorithm, and do not depend
+     * on @a chunkSize nor on the number of threads.
+     *
+     * @param itb begin iterator
+     * @param ite end iterator
+     * @param res output iterator used to export the retrieved points
+     * @param aFunctor an orientation functor, which is copied for each chunk
+     * @param chunkSize the number of points of each chunk (at least 1)
+     *
+     * @warning the sums and differences of the point coordinates must
+     * not overflow.
+     *
+     * @tparam ForwardIterator a model of forward and readable iterator
+     * @tparam OutputIterator a model of incrementable and writable iterator
+     * @tparam Functor a model of COrientationFunctor2 with a range operator
+     * writing the orientations of a range of points (e.g.
+     * InHalfPlaneByBatchFilter, InHalfPlaneBy2x2DetComputer,
+     * InHalfPlaneBySimple3x3Matrix)
+     */
+    template <typename ForwardIterator,
+	      typename OutputIterator,
+	      typename Functor >
+    void parallelConvexHullAlgorithm(const ForwardIterator& itb,
+				     const ForwardIterator& ite,
+				     OutputIterator res,
+				     Functor& aFunctor,
+				     std::size_t chunkSize = 65536 );
+
 
     /**
      *  @brief Procedure to compute the convex hull thickness given
@@ -163,6 +163,24 @@ namespace DGtal
      */
     Value operator()(const Point& aR) const;
 
+    /**
+     * Range operator, which writes the orientation of the two points
+     * given at initialisation and each point of the range
+     * [@a itb, @a ite) into @a res.
+     * @warning InHalfPlaneBy2x2DetComputer::init() should be called before
+     *
+     * @param itb begin iterator on the points to test
+     * @param ite end iterator on the points to test
+     * @param res output iterator on the orientations
+     * @return the output iterator after the last written orientation
+     *
+     * @tparam InputIterator a model of input iterator on points
+     * @tparam OutputIterator a model of output iterator on Value
+     */
+    template <typename InputIterator, typename OutputIterator>
+    OutputIterator operator()(InputIterator itb, InputIterator ite,
+                              OutputIterator res) const;
+
     /**
      * Writes/Displays the object on an output stream.
      * @param out the output stream where the object is written.
@@ -0,0 +1,254 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file InHalfPlaneByBatchFilter.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module InHalfPlaneByBatchFilter.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(InHalfPlaneByBatchFilter_RECURSES)
+#error Recursive header files inclusion detected in InHalfPlaneByBatchFilter.h
+#else // defined(InHalfPlaneByBatchFilter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define InHalfPlaneByBatchFilter_RECURSES
+
+#if !defined InHalfPlaneByBatchFilter_h
+/** Prevents repeated inclusion of headers. */
+#define InHalfPlaneByBatchFilter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <array>
+#include <iostream>
+#include "DGtal/base/Common.h"
+
+#include "DGtal/geometry/tools/determinant/C2x2DetComputer.h"
+#include "DGtal/geometry/tools/determinant/AvnaimEtAl2x2DetSignComputer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class InHalfPlaneByBatchFilter
+  /**
+   * \brief Aim: Class that implements an orientation functor, ie.
+   * it provides a way to compute the orientation of three given 2d points.
+   * More precisely, it returns:
+   * - zero if the three points belong to the same line
+   * - strictly positive if the three points are counter-clockwise oriented
+   * - striclty negative if the three points are clockwise oriented.
+   *
+   * The orientation is the sign of a 2x2 determinant, first evaluated
+   * with doubles. The sign is certain when the absolute value of the
+   * determinant exceeds a static bound of the rounding error (as in
+   * [Shewchuk, 1997]). Otherwise, the sign is computed exactly by a
+   * determinant computer on integers.
+   *
+   * Besides the evaluation of one point, the functor evaluates whole
+   * ranges of points, which is the way to go when many points are
+   * tested against the same line (e.g. to discard points before
+   * computing a convex hull). Points are then processed by blocks:
+   * their coordinates are copied into arrays of doubles, the filtered
+   * determinants of a block are computed by a loop without branches,
+   * which compilers vectorize, and only the ambiguous points of the
+   * block are given to the exact determinant computer.
+   *
+   * Basic usage:
+   @code
+   ...
+   typedef Z2i::Point Point;
+   typedef InHalfPlaneByBatchFilter<Point> MyType;
+
+   MyType orientationTest;
+   orientationTest.init( Point(0,0), Point(5,2) );
+   std::vector<MyType::Value> orientations( points.size() );
+   orientationTest( points.begin(), points.end(), orientations.begin() );
+   @endcode
+   *
+   * @tparam TPoint a model of point, whose coordinates have an
+   * absolute value less than 2^52, so that they and their differences
+   * are exactly represented by doubles.
+   * @tparam TDetComputer a model of C2x2DetComputer on integers, used
+   * for the ambiguous points, which must safely deal with integers coded
+   * with b+1 bits if the points coordinates are coded with b bits.
+   *
+   * @see InHalfPlaneBy2x2DetComputer Filtered2x2DetComputer
+   */
+  template <typename TPoint,
+            typename TDetComputer = AvnaimEtAl2x2DetSignComputer<DGtal::int64_t> >
+  class InHalfPlaneByBatchFilter
+  {
+    // ----------------------- Types  ------------------------------------
+  public:
+
+    /**
+     * Type of points
+     */
+    typedef TPoint Point;
+
+    /**
+     * Type of point array
+     */
+    typedef std::array<Point,2> PointArray;
+    /**
+     * Type used to represent the size of the array
+     */
+    typedef typename PointArray::size_type SizeArray;
+    /**
+     * static size of the array, ie. 2
+     */
+    static const SizeArray size = 2;
+
+    /**
+     * Type of determinant computer used for the ambiguous points
+     */
+    typedef TDetComputer DetComputer;
+    BOOST_CONCEPT_ASSERT(( C2x2DetComputer<DetComputer> ));
+
+    /**
+     * Type of input integers for the determinant computer
+     */
+    typedef typename TDetComputer::ArgumentInteger ArgumentInteger;
+
+    /**
+     * Type of integer for the result
+     */
+    typedef typename TDetComputer::ResultInteger Value;
+
+    /**
+     * Number of points evaluated together by the range operator.
+     */
+    static const unsigned int blockSize = 64;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Initialisation.
+     * @param aP first point
+     * @param aQ second point
+     */
+    void init(const Point& aP, const Point& aQ);
+
+    /**
+     * Initialisation.
+     * @param aA array of two points
+     */
+    void init(const PointArray& aA);
+
+    /**
+     * Main operator.
+     * @warning InHalfPlaneByBatchFilter::init() should be called before
+     * @param aR any point to test
+     * @return orientation of the three points @a aP @a aQ @a aR :
+     * - zero if the three points belong to the same line
+     * - 1 if the three points are counter-clockwise oriented
+     * - -1 if the three points are clockwise oriented
+     * @see InHalfPlaneByBatchFilter::init()
+     */
+    Value operator()(const Point& aR) const;
+
+    /**
+     * Range operator, which writes the orientation of @a aP @a aQ and
+     * each point of the range [@a itb, @a ite) into @a res.
+     * @warning InHalfPlaneByBatchFilter::init() should be called before
+     *
+     * @param itb begin iterator on the points to test
+     * @param ite end iterator on the points to test
+     * @param res output iterator on the orientations
+     * @return the output iterator after the last written orientation
+     *
+     * @tparam InputIterator a model of input iterator on points
+     * @tparam OutputIterator a model of output iterator on Value
+     */
+    template <typename InputIterator, typename OutputIterator>
+    OutputIterator operator()(InputIterator itb, InputIterator ite,
+                              OutputIterator res) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+    /**
+     * Coordinates of the first point.
+     */
+    ArgumentInteger myA, myB;
+    /**
+     * Coordinates of the first point, as doubles.
+     */
+    double myDA, myDB;
+    /**
+     * Coordinates of the vector from the first to the second point, as doubles.
+     */
+    double myU, myV;
+    /**
+     * A 2x2 determinant computer for the ambiguous points
+     */
+    mutable DetComputer myDetComputer;
+
+    /**
+     * @param aR any point
+     * @return the orientation of @a aP @a aQ @a aR computed by the
+     * determinant computer, ie. 1, -1 or 0.
+     */
+    Value exactOrientation(const Point& aR) const;
+
+  }; // end of class InHalfPlaneByBatchFilter
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'InHalfPlaneByBatchFilter'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'InHalfPlaneByBatchFilter' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPoint, typename TDetComputer>
+  std::ostream&
+  operator<< ( std::ostream & out, const InHalfPlaneByBatchFilter<TPoint, TDetComputer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/tools/determinant/InHalfPlaneByBatchFilter.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined InHalfPlaneByBatchFilter_h
+
+#undef InHalfPlaneByBatchFilter_RECURSES
+#endif // else defined(InHalfPlaneByBatchFilter_RECURSES)
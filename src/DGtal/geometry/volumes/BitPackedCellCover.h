@@ -0,0 +1,278 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BitPackedCellCover.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module BitPackedCellCover.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BitPackedCellCover_RECURSES)
+#error Recursive header files inclusion detected in BitPackedCellCover.h
+#else // defined(BitPackedCellCover_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BitPackedCellCover_RECURSES
+
+#if !defined BitPackedCellCover_h
+/** Prevents repeated inclusion of headers. */
+#define BitPackedCellCover_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+#include "DGtal/geometry/volumes/BoundedLatticePolytope.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BitPackedCellCover
+  /**
+     Description of template class 'BitPackedCellCover' <p> \brief
+     Aim: Stores a set of cells of a box of lattice points as a
+     Khalimsky grid of bits, in order to compare quickly the cells
+     touching the points of a lattice polytope with the cells
+     intersected by the polytope, as done by
+     DigitalConvexity::isFullyConvex.
+
+     The cover stores the cells of dimension between minCellDim() and
+     maxCellDim() touching the points of the box [lo,hi], ie. the
+     cells with Khalimsky coordinates within [2lo-1,2hi+1]. Cells are
+     bits, one bit per cell along the first axis, and rows of words
+     along the other axes. Cells are not inserted one by one but by
+     runs of points along the first axis (see
+     BoundedLatticePolytope::getPointRuns), that are whole ranges of
+     bits of a row, set with word masks. The inclusion or equality of
+     two covers is then checked word by word.
+
+     It is a much faster, but bounded, alternative to CellGeometry
+     for the cells of one polytope.
+
+     @code
+     typedef BitPackedCellCover< Z3i::KSpace > Cover;
+     Cover touched    ( P.getDomain().lowerBound(), P.getDomain().upperBound(), 1, 2 );
+     Cover intersected( P.getDomain().lowerBound(), P.getDomain().upperBound(), 1, 2 );
+     touched.addCellsTouchingPolytopePoints( P );
+     intersected.addCellsTouchingPolytope( P );
+     bool fully_convex = intersected.subset( touched ); // in 3D
+     @endcode
+
+     @tparam TKSpace an arbitrary model of CCellularGridSpaceND.
+  */
+  template < typename TKSpace >
+  class BitPackedCellCover
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< TKSpace > ));
+
+  public:
+    typedef BitPackedCellCover<TKSpace>     Self;
+    typedef TKSpace                         KSpace;
+    typedef typename KSpace::Integer        Integer;
+    typedef typename KSpace::Point          Point;
+    typedef typename KSpace::Space          Space;
+    typedef typename KSpace::Size           Size;
+    typedef DGtal::BoundedLatticePolytope< Space > LatticePolytope;
+    typedef DGtal::uint64_t                 Word;
+
+    /// The dimension of the space.
+    static const Dimension dimension = KSpace::dimension;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+    /// @name Standard services (construction, initialization)
+    /// @{
+
+    /**
+     * Destructor.
+     */
+    ~BitPackedCellCover() = default;
+
+    /**
+     * Constructor. The cover is empty.
+     *
+     * @param lo the lowest point of the box.
+     * @param hi the highest point of the box.
+     * @param min_cell_dim the minimal dimension of the stored cells.
+     * @param max_cell_dim the maximal dimension of the stored cells.
+     */
+    BitPackedCellCover( const Point& lo, const Point& hi,
+                        Dimension min_cell_dim = 0,
+                        Dimension max_cell_dim = KSpace::dimension );
+
+    /// @return the lowest point of the box.
+    const Point& lowerBound() const
+    { return myLower; }
+
+    /// @return the highest point of the box.
+    const Point& upperBound() const
+    { return myUpper; }
+
+    /// @return the minimal dimension of the stored cells.
+    Dimension minCellDim() const
+    { return myMinCellDim; }
+
+    /// @return the maximal dimension of the stored cells.
+    Dimension maxCellDim() const
+    { return myMaxCellDim; }
+
+    /// Removes all the cells of the cover.
+    void clear();
+
+    /// @}
+
+    // ----------------------- Cell services ------------------------------
+  public:
+    /// @name Cell services
+    /// @{
+
+    /// @param kp the Khalimsky coordinates of any cell.
+    /// @return 'true' iff the cell \a kp belongs to the cover.
+    bool test( const Point& kp ) const;
+
+    /// Adds a cell to the cover, if its dimension is within
+    /// [minCellDim(),maxCellDim()].
+    /// @param kp the Khalimsky coordinates of any cell of the box.
+    void set( const Point& kp );
+
+    /// @return the number of cells of the cover.
+    Size nbCells() const;
+
+    /// Adds the cells touching the lattice points of a polytope
+    /// (cofaces of their pointels).
+    ///
+    /// @param P any lattice polytope whose domain lies in the box.
+    void addCellsTouchingPolytopePoints( const LatticePolytope& P );
+
+    /// Adds the cells whose closure intersects a polytope. The
+    /// i-cells extending along the axes of a set E are bijective to the
+    /// lattice points of the Minkowski sum of the polytope with the
+    /// unit segments of E (see CellGeometry::getIntersectedKPoints).
+    ///
+    /// @param P any lattice polytope whose domain lies in the box,
+    /// which can be summed with unit segments (see
+    /// BoundedLatticePolytope::canBeSummed).
+    void addCellsTouchingPolytope( const LatticePolytope& P );
+
+    /// Tells if the cells of this cover are cells of \a other, word by word.
+    /// @param other any cover with the same box.
+    /// @return 'true' iff the cells of this cover are cells of \a other.
+    bool subset( const Self& other ) const;
+
+    /// Tells if this cover and \a other have the same cells, word by word.
+    /// @param other any cover with the same box.
+    /// @return 'true' iff both covers have the same cells.
+    bool equals( const Self& other ) const;
+
+    /// @}
+
+    // ----------------------- Interface --------------------------------------
+  public:
+    /// @name Interface services
+    /// @{
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /// @}
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// The lowest point of the box.
+    Point myLower;
+    /// The highest point of the box.
+    Point myUpper;
+    /// The minimal dimension of the stored cells.
+    Dimension myMinCellDim;
+    /// The maximal dimension of the stored cells.
+    Dimension myMaxCellDim;
+    /// The Khalimsky coordinates of the lowest cell, ie. 2*lo-1.
+    Point myOrigin;
+    /// The number of cells along each axis (0 when the box is empty).
+    std::vector<std::size_t> myExtent;
+    /// The number of words per row.
+    std::size_t myRowSize;
+    /// The rows of bits, the row of cell kp starting at word
+    /// rowIndex( kp ).
+    std::vector<Word> myWords;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+    /// @param kp the Khalimsky coordinates of any cell of the box.
+    /// @return the index of the first word of the row of \a kp.
+    std::size_t rowIndex( const Point& kp ) const;
+
+    /// Sets the bits of cells `kp + t e_0` for `x0 <= t <= x1` and
+    /// `t` of parity \a odd, within the row of \a kp.
+    /// @param kp the Khalimsky coordinates of any cell of the box.
+    /// @param x0 the lowest Khalimsky abscissa.
+    /// @param x1 the highest Khalimsky abscissa.
+    /// @param odd when 'true' odd abscissas are set, otherwise even ones.
+    void setRun( const Point& kp, Integer x0, Integer x1, bool odd );
+
+    /// @param kp the Khalimsky coordinates of any cell of the box.
+    /// @return the number of odd coordinates of \a kp, except the first one.
+    Dimension rowDim( const Point& kp ) const;
+
+    /// @param w any word.
+    /// @return the number of bits set in \a w.
+    static unsigned int popCount( Word w );
+
+  }; // end of class BitPackedCellCover
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BitPackedCellCover'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BitPackedCellCover' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const BitPackedCellCover<TKSpace> & object );
+
+} // namespace DGtal
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "BitPackedCellCover.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BitPackedCellCover_h
+
+#undef BitPackedCellCover_RECURSES
+#endif // else defined(BitPackedCellCover_RECURSES)
@@ -44,6 +44,7 @@
 #include <list>
 #include <vector>
 #include <string>
+#include <utility>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CSpace.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
@@ -65,6 +66,14 @@ namespace DGtal
      that we model only bounded polytopes, i.e. polytopes that can be
      included in a finite bounding box.
 
+     The enumeration services (count, getPoints, insertPoints,
+     etc.) scan the bounding domain of the polytope line by line along
+     the first axis: on each line, every half-space restricts the
+     points to an integer half-line, so that the points of the line
+     within the polytope form a run computed exactly with one floor
+     division per inequality (see computeLineRun), instead of testing
+     each point of the domain.
+
      It is a model of boost::CopyConstructible,
      boost::DefaultConstructible, boost::Assignable. 
 
@@ -537,8 +546,6 @@ namespace DGtal
      * Computes the number of integer points lying within the polytope.
      *
      * @return the number of integer points lying within the polytope.
-     *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
      */
     Integer count() const;
 
@@ -547,8 +554,6 @@ namespace DGtal
      *
      * @return the number of integer points lying within the interior of the polytope.
      *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
-     * 
      * @note `count() <= countInterior() + countBoundary()` with
      * equality when the polytope is closed.
      */
@@ -559,8 +564,6 @@ namespace DGtal
      *
      * @return the number of integer points lying on the boundary of the polytope.
      *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
-     * 
      * @note `count() <= countInterior() + countBoundary()` with
      * equality when the polytope is closed.
      */
@@ -573,8 +576,6 @@ namespace DGtal
      * @param[in] low the lowest point of the domain.
      * @param[in] hi the highest point of the domain.
      * @return the number of integer points within the polytope.
-     *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
      */
     Integer countWithin( Point low, Point hi ) const;
 
@@ -591,8 +592,6 @@ namespace DGtal
      * the method exists when this number of reached.
      *
      * @return the number of integer points within the polytope up to .
-     *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
      */
     Integer countUpTo( Integer max ) const;
 
@@ -601,7 +600,6 @@ namespace DGtal
      *
      * @param[out] pts the integer points within the polytope.
      *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
      * @note At output, pts.size() == this->count()
      */
     void getPoints( std::vector<Point>& pts ) const;
@@ -611,7 +609,6 @@ namespace DGtal
      *
      * @param[out] pts the integer points interior to the polytope.
      *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
      * @note At output, pts.size() == this->countInterior()
      */
     void getInteriorPoints( std::vector<Point>& pts ) const;
@@ -621,7 +618,6 @@ namespace DGtal
      *
      * @param[out] pts the integer points boundary to the polytope.
      *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
      * @note At output, pts.size() == this->countBoundary()
      */
     void getBoundaryPoints( std::vector<Point>& pts ) const;
@@ -633,12 +629,19 @@ namespace DGtal
      *
      * @param[in,out] pts_set the set of points where points within
      * this polytope are inserted.
-     *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
      */
     template <typename PointSet>
     void insertPoints( PointSet& pts_set ) const;
 
+    /**
+     * Computes the runs of integer points within the polytope, ie. its
+     * maximal sets of consecutive points along the first axis.
+     *
+     * @param[out] runs the first and last point of each run, in the
+     * order of the points of the polytope domain.
+     */
+    void getPointRuns( std::vector< std::pair<Point,Point> >& runs ) const;
+
     /// @}
     
     
@@ -709,6 +712,74 @@ namespace DGtal
     /// @return 'true' 
     bool internalInitFromSegment2D( Point a, Point b );
 
+    /// The sets of points enumerated line by line by the counting
+    /// and enumeration services.
+    enum class LineScan {
+      Inside,   ///< points satisfying isDomainPointInside
+      Interior, ///< points satisfying every inequality strictly
+      Closure,  ///< points satisfying every inequality largely
+      Boundary  ///< points of the closure that are not interior
+    };
+
+    /// Computes the run of integer points `p + t e_0`, for \a lo <=
+    /// `t` <= \a hi, that belong to the set \a scan. Each half-space
+    /// `a.x <= b` restricts the line to `a_0 t <= b - a.p`, hence to
+    /// an exact integer half-line computed by one floor division (a
+    /// strict inequality `a.x < b` is the large one `a.x <= b-1`).
+    ///
+    /// @param p any point with p[0] = 0, the origin of the line.
+    /// @param lo the lowest possible value of `t`.
+    /// @param hi the highest possible value of `t`.
+    /// @param scan the set of points that are enumerated, which is
+    /// not LineScan::Boundary.
+    /// @param[out] x0 the lowest value of `t` within the set.
+    /// @param[out] x1 the highest value of `t` within the set.
+    /// @return 'true' if the run is not empty, 'false' otherwise.
+    bool computeLineRun( const Point& p, Integer lo, Integer hi, LineScan scan,
+                         Integer& x0, Integer& x1 ) const;
+
+    /// Computes the runs of integer points of the line `p + t e_0`
+    /// that belong to the set \a scan. There is at most one run,
+    /// except for LineScan::Boundary, where the interior run is
+    /// removed from the closure run, leaving at most two runs.
+    ///
+    /// @param p any point with p[0] = 0, the origin of the line.
+    /// @param lo the lowest possible value of `t`.
+    /// @param hi the highest possible value of `t`.
+    /// @param scan the set of points that are enumerated.
+    /// @param[out] x the bounds of the runs, ie. `x[0]..x[1]` then `x[2]..x[3]`.
+    /// @return the number of runs (0, 1 or 2).
+    unsigned int computeLineRuns( const Point& p, Integer lo, Integer hi, LineScan scan,
+                                  Integer x[ 4 ] ) const;
+
+    /// @param lo the lowest point of some domain.
+    /// @param hi the highest point of some domain.
+    /// @return the number of lines parallel to the first axis within
+    /// the domain [lo,hi].
+    static std::size_t nbLines( const Point& lo, const Point& hi );
+
+    /// @param lo the lowest point of some domain.
+    /// @param hi the highest point of some domain.
+    /// @param l the index of a line within the domain [lo,hi], lines
+    /// being ordered as the points of HyperRectDomain.
+    /// @return the origin of the line \a l, whose first coordinate is 0.
+    static Point lineOrigin( const Point& lo, const Point& hi, std::size_t l );
+
+    /// Counts the points of the set \a scan within the domain
+    /// [lo,hi]. Lines are processed by blocks, in parallel with OpenMP.
+    /// @param lo the lowest point of the domain.
+    /// @param hi the highest point of the domain.
+    /// @param scan the set of points that are counted.
+    /// @return the number of points of \a scan within [lo,hi].
+    Integer countLineRuns( const Point& lo, const Point& hi, LineScan scan ) const;
+
+    /// Appends the points of the set \a scan within the polytope
+    /// domain to \a pts, in the order of the points of the domain.
+    /// Lines are processed by blocks, in parallel with OpenMP.
+    /// @param[in,out] pts the points are appended to this vector.
+    /// @param scan the set of points that are enumerated.
+    void getLineRuns( std::vector<Point>& pts, LineScan scan ) const;
+
   }; // end of class BoundedLatticePolytope
 
   namespace detail {
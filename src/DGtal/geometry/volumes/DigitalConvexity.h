@@ -50,8 +50,10 @@
 #include "DGtal/topology/CCellularGridSpaceND.h"
 #include "DGtal/topology/KhalimskySpaceND.h"
 #include "DGtal/geometry/volumes/BoundedLatticePolytope.h"
+#include "DGtal/geometry/volumes/LatticeQuickHull3D.h"
 #include "DGtal/geometry/volumes/BoundedRationalPolytope.h"
 #include "DGtal/geometry/volumes/CellGeometry.h"
+#include "DGtal/geometry/volumes/BitPackedCellCover.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -163,6 +165,21 @@ namespace DGtal
     static
     LatticePolytope makeSimplex( std::initializer_list<Point> l );
 
+    /**
+     * Constructs the lattice polytope that is the convex hull of an
+     * arbitrary range [itB,itE) of lattice points, with
+     * LatticeQuickHull3D. Only available in 3D.
+     *
+     * @tparam PointIterator any model of forward iterator on Point.
+     * @param itB the start of the range of points.
+     * @param itE past the end the range of points.
+     * @return the convex hull of the points, as a lattice polytope
+     * that can be summed with unit cells.
+     */
+    template <typename PointIterator>
+    static
+    LatticePolytope makePolytope( PointIterator itB, PointIterator itE );
+
     /**
      * Constructs a rational polytope from a rational simplex given as a range
      * [itB,itE) of lattice points.  Note that the range must contain
@@ -362,6 +379,9 @@ namespace DGtal
     /// @note A polytope is always digitally 0-convex. Furthermore, if
     /// it is not digitally d-1-convex then it is digitally not d-convex
     /// (d := KSpace::dimension).
+    ///
+    /// @note The cells are compared as bit-packed Khalimsky grids over
+    /// the domain of P (see BitPackedCellCover).
     bool isKConvex( const LatticePolytope& P, const Dimension k ) const;
 
     /// Tells if a given polytope \a P is fully digitally convex. The
@@ -377,8 +397,22 @@ namespace DGtal
     /// it is not digitally d-1-convex then it is digitally d-convex
     /// (d := KSpace::dimension). Hence, we only check k-convexity for
     /// 1 <= k <= d-1.
+    ///
+    /// @note The cells are compared as bit-packed Khalimsky grids over
+    /// the domain of P (see BitPackedCellCover).
     bool isFullyConvex( const LatticePolytope& P ) const;
 
+    /// Tells which polytopes of a range are fully digitally convex,
+    /// in parallel with OpenMP.
+    ///
+    /// @param[in] polytopes any lattice polytopes such that `P.canBeSummed() == true`.
+    /// @param[out] convex 'true' at index i iff `polytopes[ i ]` is
+    /// fully digitally convex (resized).
+    ///
+    /// @see isFullyConvex( const LatticePolytope& ) const
+    void isFullyConvex( const std::vector<LatticePolytope>& polytopes,
+                        std::vector<bool>& convex ) const;
+
     /// Tells if a given polytope \a P is digitally k-subconvex of some
     /// cell cover \a C. The digital 0-subconvexity is the usual
     /// property \f$ Conv( P \cap Z^d ) \subset C \cap Z^d)
@@ -78,6 +78,7 @@ namespace DGtal
    * @tparam TDomain any model of CDomain
    * @tparam TDigitalSetContainer container type to store the point predicate (default: DigitalSetBySTLSet)
    *
+   * @see KanungoNoiseGenerator to generate many noisy versions of a predicate.
    */
   template <typename TPointPredicate, typename TDomain,
             typename TDigitalSetContainer=DigitalSetBySTLSet<TDomain> >
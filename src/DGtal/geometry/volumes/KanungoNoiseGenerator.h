@@ -0,0 +1,259 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file KanungoNoiseGenerator.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module KanungoNoiseGenerator.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(KanungoNoiseGenerator_RECURSES)
+#error Recursive header files inclusion detected in KanungoNoiseGenerator.h
+#else // defined(KanungoNoiseGenerator_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define KanungoNoiseGenerator_RECURSES
+
+#if !defined KanungoNoiseGenerator_h
+/** Prevents repeated inclusion of headers. */
+#define KanungoNoiseGenerator_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/topology/BitPackedOccupancy.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class KanungoNoiseGenerator
+  /**
+   * Description of template class 'KanungoNoiseGenerator' <p>
+   * \brief Aim: Generates many noisy versions of a point predicate
+   * with the Kanungo noise model of KanungoNoise: the label of a
+   * point at distance @f$ d @f$ to the border of the predicate is
+   * reverted with probability @f$ \alpha^{1+d} @f$.
+   *
+   * The two distance transformations (inside and outside the
+   * predicate) are computed once at construction and stored as one
+   * signed distance per point of the domain. Each noisy version is
+   * then given by a noise parameter and a seed, and written into a
+   * vector image or a bit-packed occupancy grid, in parallel over the
+   * lines of the domain when DGtal is built with OpenMP (WITH_OPENMP).
+   *
+   * The random number of a point is computed from the seed and the
+   * index of the point in the domain by a counter-based generator (a
+   * splitmix64 hash), instead of being drawn from a sequential
+   * generator. Noisy versions are thus reproducible whatever the
+   * number of threads, and points whose flip probability is less
+   * than the smallest random number (far from the border) are not
+   * evaluated at all.
+   *
+   * @note The noisy versions differ from the ones of KanungoNoise,
+   * which draws the random numbers of the points in the domain order
+   * with std::mt19937.
+   *
+   * @code
+   * KanungoNoiseGenerator< Z3i::DigitalSet, Z3i::Domain > generator( set, domain );
+   * ImageContainerBySTLVector< Z3i::Domain, unsigned char > image( domain );
+   * for ( DGtal::uint64_t seed = 0; seed < 100; ++seed )
+   *   {
+   *     generator.generate( 0.5, seed, image );
+   *     ...
+   *   }
+   * @endcode
+   *
+   * @tparam TPointPredicate any model of point predicate concept (concepts::CPointPredicate)
+   * @tparam TDomain any HyperRectDomain
+   *
+   * @see KanungoNoise
+   */
+  template <typename TPointPredicate, typename TDomain>
+  class KanungoNoiseGenerator
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate<TPointPredicate> ));
+
+  public:
+    typedef KanungoNoiseGenerator<TPointPredicate, TDomain> Self;
+    typedef TPointPredicate             PointPredicate;
+    typedef TDomain                     Domain;
+    typedef typename Domain::Space      Space;
+    typedef typename Domain::Point      Point;
+    typedef typename Space::Integer     Integer;
+    typedef DGtal::uint64_t             Seed;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Computes the distance transformations of the
+     * predicate and of its complement within the domain.
+     *
+     * @param aPredicate input point predicate defining the input object.
+     * @param aDomain domain of the noisy versions.
+     */
+    KanungoNoiseGenerator( ConstAlias<PointPredicate> aPredicate,
+                           const Domain & aDomain );
+
+    /**
+     * Destructor.
+     */
+    ~KanungoNoiseGenerator() = default;
+
+    /// @return the domain of the noisy versions.
+    const Domain & domain() const
+    { return myDomain; }
+
+    // ----------------------- Noise services ------------------------------
+  public:
+
+    /**
+     * @param aPoint any point of the domain.
+     * @param anAlpha noise parameter between ]0,1[.
+     * @param aSeed the seed of the noisy version.
+     * @return 'true' iff \a aPoint is inside the noisy version of
+     * parameter \a anAlpha and seed \a aSeed.
+     */
+    bool isInside( const Point & aPoint, double anAlpha, Seed aSeed ) const;
+
+    /**
+     * Writes a noisy version of the predicate into an image (in
+     * parallel with OpenMP).
+     *
+     * @tparam TValue any type of value but bool (std::vector<bool>
+     * cannot be written concurrently).
+     * @param anAlpha noise parameter between ]0,1[.
+     * @param aSeed the seed of the noisy version.
+     * @param[out] anImage an image on the domain, whose values are 1
+     * inside the noisy version and 0 outside.
+     */
+    template <typename TValue>
+    void generate( double anAlpha, Seed aSeed,
+                   ImageContainerBySTLVector<Domain, TValue> & anImage ) const;
+
+    /**
+     * Writes a noisy version of the predicate into a bit-packed
+     * occupancy grid (in parallel with OpenMP). Points of the grid
+     * outside the domain are left unchanged.
+     *
+     * @param anAlpha noise parameter between ]0,1[.
+     * @param aSeed the seed of the noisy version.
+     * @param[in,out] anOccupancy any occupancy grid whose box contains the domain.
+     */
+    void generate( double anAlpha, Seed aSeed,
+                   BitPackedOccupancy<Space> & anOccupancy ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+    /// The domain of the noisy versions.
+    Domain myDomain;
+    /// The number of points of the domain along each axis.
+    std::vector<std::size_t> myExtent;
+    /// For each point of the domain (in the domain order), its
+    /// distance to the border of the predicate, positive inside the
+    /// predicate and negative outside.
+    std::vector<float> myDistances;
+
+    /// @param aPoint any point of the domain.
+    /// @return the index of \a aPoint in the domain order.
+    std::size_t index( const Point & aPoint ) const;
+
+    /// @param l the index of a line along the first axis.
+    /// @return the first point of the line \a l.
+    Point lineOrigin( std::size_t l ) const;
+
+    /// @param anAlpha noise parameter between ]0,1[.
+    /// @return the distance beyond which the flip probability is
+    /// less than any random number given by uniform.
+    static double maxDistance( double anAlpha );
+
+    /// @param i the index of some point.
+    /// @param aLogAlpha the logarithm of the noise parameter.
+    /// @param aMaxDistance the value given by maxDistance.
+    /// @param aKey the key given by mix( aSeed ).
+    /// @return 'true' iff the point \a i is inside the noisy version.
+    bool noisyValue( std::size_t i, double aLogAlpha, double aMaxDistance,
+                     Seed aKey ) const;
+
+    /// The finalizer of the splitmix64 generator, a bijective
+    /// mixing of the bits of a 64-bit integer.
+    /// @param z any integer.
+    /// @return the mixed integer.
+    static Seed mix( Seed z );
+
+    /// Counter-based random number generator.
+    /// @param aKey the key of the noisy version.
+    /// @param i the counter, ie. the index of a point.
+    /// @return a uniform random number in ]0,1[, which is a multiple
+    /// of 2^-54 (hence at least 2^-54).
+    static double uniform( Seed aKey, std::size_t i );
+
+  }; // end of class KanungoNoiseGenerator
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'KanungoNoiseGenerator'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'KanungoNoiseGenerator' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TP, typename TD>
+  std::ostream&
+  operator<< ( std::ostream & out, const KanungoNoiseGenerator<TP,TD> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/KanungoNoiseGenerator.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined KanungoNoiseGenerator_h
+
+#undef KanungoNoiseGenerator_RECURSES
+#endif // else defined(KanungoNoiseGenerator_RECURSES)
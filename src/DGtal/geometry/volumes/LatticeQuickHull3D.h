@@ -0,0 +1,431 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file LatticeQuickHull3D.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module LatticeQuickHull3D.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(LatticeQuickHull3D_RECURSES)
+#error Recursive header files inclusion detected in LatticeQuickHull3D.h
+#else // defined(LatticeQuickHull3D_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define LatticeQuickHull3D_RECURSES
+
+#if !defined LatticeQuickHull3D_h
+/** Prevents repeated inclusion of headers. */
+#define LatticeQuickHull3D_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <array>
+#include <string>
+#include <set>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CSpace.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/geometry/volumes/BoundedLatticePolytope.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class LatticeQuickHull3D
+  /**
+     Description of template class 'LatticeQuickHull3D' <p> \brief
+     Aim: Computes the convex hull of a range of 3D lattice points
+     with the quickhull algorithm [Barber, Dobkin and Huhdanpaa,
+     1996], its facets, and the corresponding lattice polytope as a
+     BoundedLatticePolytope.
+
+     All the predicates are exact. The orientation of a point with
+     respect to a facet is first evaluated with doubles, and is
+     certain when the result exceeds a static bound of the rounding
+     errors. Only the remaining, almost degenerate, predicates are
+     computed with the internal integer type. The facet normals
+     are computed once, with the internal integer type.
+
+     The points are cut into chunks, whose convex hulls are computed
+     in parallel when DGtal is built with OpenMP (WITH_OPENMP). The
+     convex hull of the vertices of these chunk hulls is then
+     computed. Chunks are defined by their size only, so the result
+     does not depend on the number of threads.
+
+     Degenerate point sets are handled: if the points are coplanar,
+     the hull is a convex polygon, computed in a projection plane,
+     and if they are collinear, the hull is a segment.
+
+     @code
+     typedef Z3i::Space Space;
+     typedef LatticeQuickHull3D< Space > QuickHull;
+     std::vector< Z3i::Point > points = ...;
+     QuickHull hull;
+     hull.compute( points.begin(), points.end() );
+     QuickHull::LatticePolytope P = hull.makePolytope();
+     @endcode
+
+     It is a model of boost::CopyConstructible,
+     boost::DefaultConstructible, boost::Assignable.
+
+     @tparam TSpace an arbitrary model of CSpace of dimension 3.
+
+     @tparam TInternalInteger the integer type used for facet
+     normals and for almost degenerate predicates, which must
+     represent integers of order \f$ 6 D^3 \f$ where D is the
+     diameter of the point set. The default one is the
+     BoundedLatticePolytope::BigInteger type, which is DGtal::int64_t
+     when DGtal is built without GMP (hence D must be less than
+     \f$ 2^{19} \f$). CheckedInt128 is another choice.
+
+     @see BoundedLatticePolytope DigitalConvexity::makePolytope
+   */
+  template < typename TSpace,
+             typename TInternalInteger = typename BoundedLatticePolytope<TSpace>::BigInteger >
+  class LatticeQuickHull3D
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace< TSpace > ));
+    static_assert( TSpace::dimension == 3,
+                   "LatticeQuickHull3D is only defined in dimension 3." );
+
+  public:
+    typedef LatticeQuickHull3D<TSpace, TInternalInteger> Self;
+    typedef TSpace                                  Space;
+    typedef typename Space::Integer                 Integer;
+    typedef typename Space::Point                   Point;
+    typedef typename Space::Vector                  Vector;
+    typedef TInternalInteger                        InternalInteger;
+    typedef typename SpaceND< 3, InternalInteger >::Vector InternalVector;
+    typedef BoundedLatticePolytope< Space >         LatticePolytope;
+    typedef typename LatticePolytope::Domain        Domain;
+    typedef typename LatticePolytope::HalfSpace     HalfSpace;
+    typedef std::size_t                             Index;
+    /// A triangle given by three indices in the vector of vertices,
+    /// counterclockwise oriented when seen from outside.
+    typedef std::array< Index, 3 >                  Triangle;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+    /// @name Standard services (construction, initialization, assignment)
+    /// @{
+
+    /**
+     * Destructor.
+     */
+    ~LatticeQuickHull3D() = default;
+
+    /**
+     * Constructor. The hull is empty.
+     */
+    LatticeQuickHull3D();
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    LatticeQuickHull3D ( const Self & other ) = default;
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    Self & operator= ( const Self & other ) = default;
+
+    /// Clears the hull.
+    void clear();
+
+    /**
+     * Computes the convex hull of the range of points [itB,itE).
+     *
+     * @tparam PointIterator any model of forward iterator on Point.
+     * @param itB the start of the range of points.
+     * @param itE past the end of the range of points.
+     * @param chunkSize the number of points whose convex hulls are
+     * computed independently (and in parallel) before merging them
+     * (at least 4).
+     *
+     * @return the affine dimension of the points, i.e. -1 if the
+     * range is empty, 0 for a single point, 1 for a segment, 2 for a
+     * polygon and 3 for a polyhedron.
+     */
+    template <typename PointIterator>
+    int compute( PointIterator itB, PointIterator itE,
+                 std::size_t chunkSize = 65536 );
+
+    /// @}
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+    /// @name Accessors
+    /// @{
+
+    /// @return the affine dimension of the hull, -1 if it is empty.
+    int affineDimension() const;
+
+    /**
+     * @return the vertices of the hull. For a polyhedron, they are the
+     * vertices of its triangulated boundary (see triangles()), and
+     * some of them may lie in the relative interior of a facet or of
+     * an edge when points are coplanar. For a polygon, they are its
+     * extremal points, counterclockwise ordered around the normal of
+     * its plane (see facets()). For a segment, they are its two
+     * extremities.
+     */
+    const std::vector<Point>& vertices() const;
+
+    /**
+     * @return the triangles of the boundary of a polyhedron, whose
+     * vertices are indices in vertices(), and are counterclockwise
+     * ordered when seen from outside. Empty if the hull is not a
+     * polyhedron.
+     */
+    const std::vector<Triangle>& triangles() const;
+
+    /**
+     * @return the facets of the hull, as half-spaces \f$ N.x \le c
+     * \f$ with irreducible normal vectors N. Coplanar triangles give
+     * one facet. For a polygon, the two first facets are the two
+     * half-spaces bounding its plane, the next ones contain its
+     * edges. Empty if the hull has dimension lower than 2.
+     */
+    const std::vector<HalfSpace>& facets() const;
+
+    /**
+     * @return the lattice polytope that is the convex hull of the
+     * points, i.e. defined by its bounding box, its facets, and the
+     * edge constraints that allow Minkowski sums (so
+     * LatticePolytope::canBeSummed() is 'true'). The polytope is
+     * empty if the hull is empty.
+     */
+    LatticePolytope makePolytope() const;
+
+    /// @}
+
+    // ----------------------- Interface --------------------------------------
+  public:
+    /// @name Interface
+    /// @{
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /// @}
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// The affine dimension of the hull (-1 if empty).
+    int myDimension;
+    /// The vertices of the hull.
+    std::vector<Point> myVertices;
+    /// The boundary triangles of a polyhedral hull.
+    std::vector<Triangle> myTriangles;
+    /// The facets of the hull.
+    std::vector<HalfSpace> myFacets;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Convex hull of some points, as computed for a chunk or for the
+     * whole range. Its vertices are the extremal points of the hull
+     * (plus some boundary points if the hull is a polyhedron).
+     */
+    struct Hull
+    {
+      /// The affine dimension of the points (-1 if empty).
+      int dimension;
+      /// The vertices of the hull.
+      std::vector<Point> vertices;
+      /// The boundary triangles if dimension is 3.
+      std::vector<Triangle> triangles;
+    };
+
+    /**
+     * A triangle of the boundary during the quickhull algorithm.
+     */
+    struct Facet
+    {
+      /// Its vertices, as indices of points.
+      Triangle v;
+      /// Its neighbors, nbr[i] being across the edge (v[i],v[i+1]).
+      std::array< Index, 3 > nbr;
+      /// Its exact outward normal vector.
+      InternalVector n;
+      /// Its normal vector, as doubles.
+      double dn[ 3 ];
+      /// Its first vertex, as doubles.
+      double da[ 3 ];
+      /// The indices of the points above this facet (its outside set).
+      std::vector<Index> outside;
+      /// The point of the outside set farthest from this facet.
+      Index furthest;
+      /// The distance of this point times the norm of the normal.
+      double furthestDistance;
+      /// 'false' once the facet is removed from the hull.
+      bool alive;
+      /// Last visibility test where it was found visible.
+      unsigned int mark;
+    };
+
+    /**
+     * @param p any point.
+     * @return the point \a p with the internal integer type.
+     */
+    static InternalVector toInternal( const Point& p );
+
+    /**
+     * @param a any point.
+     * @param b any point.
+     * @param c any point.
+     * @return the exact normal vector of the triangle (a,b,c).
+     */
+    static InternalVector exactNormal( const Point& a, const Point& b, const Point& c );
+
+    /**
+     * Irreducible normal vector.
+     * @param n any non null vector.
+     * @return the vector \a n divided by the gcd of its components.
+     */
+    static Vector toVector( InternalVector n );
+
+    /**
+     * Exact orientation predicate.
+     * @param n any normal vector.
+     * @param a any point.
+     * @param p any point.
+     * @return the sign of \f$ n.(p-a) \f$, i.e. 1, 0 or -1.
+     */
+    static int orientation( const InternalVector& n, const Point& a, const Point& p );
+
+    /**
+     * Filtered orientation predicate.
+     * @param[in] f any facet.
+     * @param[in] points the points.
+     * @param[in] p the index of any point.
+     * @param[out] d the approximate signed distance of p to f, times
+     * the norm of the normal of f.
+     * @return 1 if the point is above the facet, 0 if it is on its
+     * plane, -1 if it is below.
+     */
+    static int orientation( const Facet& f, const std::vector<Point>& points,
+                            Index p, double& d );
+
+    /**
+     * @param[in] f any facet.
+     * @param[in] q any point.
+     * @param[out] bound a bound on the rounding error of the result.
+     * @return the signed distance of q to f, times the norm of the
+     * normal of f, computed with doubles.
+     */
+    static double distance( const Facet& f, const Point& q, double& bound );
+
+    /**
+     * Initializes a facet.
+     * @param[out] f the facet.
+     * @param[in] points the points.
+     * @param[in] a the index of its first vertex.
+     * @param[in] b the index of its second vertex.
+     * @param[in] c the index of its third vertex.
+     */
+    static void initFacet( Facet& f, const std::vector<Point>& points,
+                           Index a, Index b, Index c );
+
+    /**
+     * Computes the convex hull of the given points.
+     * @param[in] points any points.
+     * @param[out] hull their convex hull.
+     */
+    static void computeHull( const std::vector<Point>& points, Hull& hull );
+
+    /**
+     * Computes the convex hull of coplanar, non collinear, points.
+     * @param[in] points any points lying in a plane.
+     * @param[in] normal the normal vector of this plane.
+     * @param[out] hull their convex hull (a polygon).
+     */
+    static void computePlanarHull( const std::vector<Point>& points,
+                                   const InternalVector& normal, Hull& hull );
+
+    /**
+     * Computes the facets of the current hull.
+     */
+    void computeFacets();
+
+    /**
+     * Adds to @\a constraints the half-spaces bounded by a plane
+     * containing the edge [a,b] and an axis, that contain the hull.
+     *
+     * @param[in,out] constraints the half-spaces.
+     * @param[in,out] normals the normal vectors of the half-spaces.
+     * @param[in] a any vertex of the hull.
+     * @param[in] b another vertex such that [a,b] is an edge of the hull.
+     * @param[in] c1 a vertex, not on the line (a,b), of a facet containing [a,b].
+     * @param[in] c2 a vertex, not on the line (a,b), of the other
+     * facet containing [a,b] (or \a c1 for a polygon).
+     */
+    void addEdgeConstraints( std::vector<HalfSpace>& constraints,
+                             std::set<Vector>& normals,
+                             const Point& a, const Point& b,
+                             const Point& c1, const Point& c2 ) const;
+
+  }; // end of class LatticeQuickHull3D
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'LatticeQuickHull3D'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'LatticeQuickHull3D' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace, typename TInternalInteger>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const LatticeQuickHull3D<TSpace, TInternalInteger> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/LatticeQuickHull3D.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined LatticeQuickHull3D_h
+
+#undef LatticeQuickHull3D_RECURSES
+#endif // else defined(LatticeQuickHull3D_RECURSES)
@@ -45,6 +45,8 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CountedPtr.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/Clone.h"
+#include "DGtal/base/RingBuffer.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
 #include "DGtal/kernel/sets/DigitalSetDomain.h"
 #include "DGtal/topology/DomainAdjacency.h"
@@ -70,8 +72,18 @@ namespace DGtal
   at distance 0. Each layer is at a different distance from the
   initial core. The expander move layer by layer but the user is
   free to navigate on each layer.
+
+  The queue is a circular buffer and the neighbors of the expanded
+  vertex are written in a buffer of the visitor, so that expanding
+  vertices does not allocate once these buffers are large enough.
+  Since this buffer is an array of nodes, the Vertex type of the graph
+  must be default constructible (as well as copy constructible).
+  The set of marked vertices may be given at construction, e.g. a
+  DomainMarkSet on caller-provided bits when vertices are points.
  
   @tparam TGraph the type of the graph (models of CUndirectedSimpleLocalGraph).
+  @tparam TMarkSet the type that is used to store marked
+  vertices. Should be a set of Vertex, hence a model of CSet.
  
   @code
      Graph g( ... );
@@ -113,8 +125,9 @@ namespace DGtal
     /// Type stocking the vertex and its topological distance wrt the
     /// initial point or set.
     typedef std::pair< Vertex, Data > Node;
-    /// Internal data structure for computing the breadth-first expansion.
-    typedef std::queue< Node > NodeQueue;
+    /// Internal data structure for computing the breadth-first
+    /// expansion (requires a default constructible Node, hence Vertex).
+    typedef std::queue< Node, RingBuffer< Node > > NodeQueue;
     /// Internal data structure for storing vertices.
     typedef std::vector< Vertex > VertexList;
 
@@ -166,6 +179,25 @@ namespace DGtal
     BreadthFirstVisitor( ConstAlias<Graph> graph, 
                          VertexIterator b, VertexIterator e );
 
+    /**
+       Constructor from iterators and an initial set of marked
+       vertices. The vertices visited between the iterators provide
+       the initial core of the breadth first traversal, while the
+       other marked vertices are never visited.
+
+       @tparam VertexIterator any type of single pass iterator on vertices.
+       @param graph the graph in which the breadth first traversal takes place.
+       @param b the begin iterator in a container of vertices. 
+       @param e the end iterator in a container of vertices. 
+       @param marks the initially marked vertices (cloned, or moved
+       when given as a temporary, so that a DomainMarkSet keeps
+       aliasing the caller bits).
+    */
+    template <typename VertexIterator>
+    BreadthFirstVisitor( ConstAlias<Graph> graph, 
+                         VertexIterator b, VertexIterator e,
+                         Clone<MarkSet> marks );
+
 
     /**
        @return a const reference on the graph that is traversed.
@@ -288,6 +320,11 @@ namespace DGtal
      */
     NodeQueue myQueue;
 
+    /**
+       Buffer storing the neighbors of the expanded vertex.
+     */
+    VertexList myNeighbors;
+
     // ------------------------- Hidden services ------------------------------
   protected:
 
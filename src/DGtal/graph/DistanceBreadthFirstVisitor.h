@@ -42,8 +42,10 @@
 // Inclusions
 #include <iostream>
 #include <queue>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/Clone.h"
 #include "DGtal/base/CountedPtr.h"
 #include "DGtal/graph/CUndirectedSimpleLocalGraph.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -196,6 +198,17 @@ while ( ! visitor.finished() )
     }
    @endcode
 
+   Layers may also be expanded in a level-synchronous way with
+   DistanceBreadthFirstVisitor::expandLayerInParallel: all the vertices
+   of the current layer form one frontier, whose neighbors and
+   distances are computed in parallel when DGtal is built with OpenMP
+   (WITH_OPENMP), then marked and queued in the order of the frontier.
+   The graph and the distance object should then support concurrent
+   const calls.
+
+   The set of marked vertices may be given at construction, e.g. a
+   DomainMarkSet on caller-provided bits when vertices are points.
+
    @see testDistancePropagation.cpp
    @see testObject.cpp
    */
@@ -309,6 +322,28 @@ while ( ! visitor.finished() )
                      const VertexFunctor & distance,
                      VertexIterator b, VertexIterator e );
 
+    /**
+       Constructor from a graph, a vertex functor, two iterators
+       specifying a range and an initial set of marked vertices. The
+       vertices visited between the iterators provide the initial
+       core of the distance ordering traversal, while the other
+       marked vertices are never visited.
+
+       @tparam VertexIterator any type of single pass iterator on vertices.
+       @param graph the graph in which the distance ordering traversal takes place (aliased).
+       @param distance the distance object, a functor Vertex -> Scalar (cloned).
+       @param b the begin iterator in a container of vertices. 
+       @param e the end iterator in a container of vertices. 
+       @param marks the initially marked vertices (cloned, or moved
+       when given as a temporary, so that a DomainMarkSet keeps
+       aliasing the caller bits).
+    */
+    template <typename VertexIterator>
+    DistanceBreadthFirstVisitor( ConstAlias<Graph> graph, 
+                     const VertexFunctor & distance,
+                     VertexIterator b, VertexIterator e,
+                     Clone<MarkSet> marks );
+
 
     /**
        @return a const reference on the graph that is traversed.
@@ -405,6 +440,33 @@ while ( ! visitor.finished() )
      */
     template <typename VertexPredicate>
     void expandLayer( const VertexPredicate & authorized_vtx );
+
+    /**
+       Goes to the next layer and take into account the current
+       layer for determining the future visited vertices, as
+       expandLayer, but the vertices of the layer are expanded
+       together (in parallel with OpenMP). The same vertices are
+       marked and queued with the same distances as with
+       expandLayer, independently of the number of threads.
+
+       NB: valid only if not 'finished()'.
+     */
+    void expandLayerInParallel();
+
+    /**
+       Goes to the next layer and take into account the current
+       layer for determining the future visited vertices, as
+       expandLayer, but the vertices of the layer are expanded
+       together (in parallel with OpenMP).
+
+       @tparam VertexPredicate a type that satisfies CPredicate on Vertex.
+       @param authorized_vtx the predicate that should satisfy the
+       visited vertices (called concurrently).
+
+       NB: valid only if not 'finished()'.
+     */
+    template <typename VertexPredicate>
+    void expandLayerInParallel( const VertexPredicate & authorized_vtx );
     
     /**
        @return 'true' if all possible elements have been visited.
@@ -500,6 +562,22 @@ while ( ! visitor.finished() )
      */
     NodeQueue myQueue;
 
+    /**
+       Buffer storing the neighbors of the expanded vertex.
+     */
+    VertexList myNeighbors;
+
+    /**
+       Buffer storing the frontier of expandLayerInParallel.
+     */
+    std::vector< Node > myFrontier;
+
+    /**
+       Buffers storing the candidate nodes found from each block of
+       the frontier in expandLayerInParallel.
+     */
+    std::vector< std::vector< Node > > myCandidates;
+
     // ------------------------- Hidden services ------------------------------
   protected:
 
@@ -509,6 +587,38 @@ while ( ! visitor.finished() )
      */
     DistanceBreadthFirstVisitor();
 
+    /// Tag meaning that all the neighbors of a vertex are authorized.
+    struct AllNeighbors {};
+
+    /**
+       Writes all the neighbors of a vertex.
+       @param out an output iterator on vertices.
+       @param v any vertex.
+    */
+    template <typename OutputIterator>
+    void writeNeighbors( OutputIterator & out, const Vertex & v,
+                         const AllNeighbors & ) const
+    { myGraph->writeNeighbors( out, v ); }
+
+    /**
+       Writes the neighbors of a vertex satisfying a predicate.
+       @param out an output iterator on vertices.
+       @param v any vertex.
+       @param authorized_vtx the predicate that should satisfy the neighbors.
+    */
+    template <typename OutputIterator, typename VertexPredicate>
+    void writeNeighbors( OutputIterator & out, const Vertex & v,
+                         const VertexPredicate & authorized_vtx ) const
+    { myGraph->writeNeighbors( out, v, authorized_vtx ); }
+
+    /**
+       Level-synchronous expansion of the current layer.
+       @param authorized_vtx the predicate that should satisfy the
+       visited vertices, or AllNeighbors.
+    */
+    template <typename VertexPredicate>
+    void expandFrontier( const VertexPredicate & authorized_vtx );
+
   private:
 
     /**
@@ -0,0 +1,318 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DomainMarkSet.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module DomainMarkSet.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DomainMarkSet_RECURSES)
+#error Recursive header files inclusion detected in DomainMarkSet.h
+#else // defined(DomainMarkSet_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DomainMarkSet_RECURSES
+
+#if !defined DomainMarkSet_h
+/** Prevents repeated inclusion of headers. */
+#define DomainMarkSet_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include "boost/dynamic_bitset.hpp"
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Alias.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DomainMarkSet
+  /**
+     Description of template class 'DomainMarkSet' <p> \brief Aim: A
+     set of points of a HyperRectDomain stored as one bit per point
+     of the domain, meant to be the set of marked vertices (MarkSet)
+     of graph visitors like BreadthFirstVisitor or
+     DistanceBreadthFirstVisitor when the vertices are points.
+
+     Finding, inserting and erasing points are a few arithmetic
+     operations, without allocation. The bits are either owned by the
+     set or provided by the caller, in which case the caller sees the
+     marks made by a visitor and may pre-mark points so that they are
+     never visited (e.g. points outside a region of interest), and
+     may reuse the same memory for successive traversals:
+
+     @code
+     boost::dynamic_bitset<> marks;
+     typedef DomainMarkSet< Z3i::Domain > MarkSet;
+     BreadthFirstVisitor< Z3i::Object26_6, MarkSet >
+       visitor( object, seeds.begin(), seeds.end(), MarkSet( domain, marks ) );
+     @endcode
+
+     A copy of a set always owns its bits (a copy of an aliasing set
+     is a deep copy), while a moved set keeps aliasing the same bits.
+
+     @tparam TDomain the type of domain, a HyperRectDomain.
+   */
+  template <typename TDomain>
+  class DomainMarkSet
+  {
+  public:
+    typedef DomainMarkSet<TDomain>            Self;
+    typedef TDomain                           Domain;
+    typedef typename Domain::Point            Point;
+    typedef typename Domain::Space::Integer   Integer;
+    typedef Point                             key_type;
+    typedef Point                             value_type;
+    typedef std::size_t                       size_type;
+    typedef std::size_t                       Size;
+    typedef boost::dynamic_bitset<>           Bitset;
+
+    /// Forward iterator on the points of the set, in the order of
+    /// the domain.
+    class ConstIterator
+    {
+      friend class DomainMarkSet<TDomain>;
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef Point                     value_type;
+      typedef std::ptrdiff_t            difference_type;
+      typedef const Point*              pointer;
+      typedef Point                     reference;
+
+      /// Default constructor (invalid iterator).
+      ConstIterator() : mySet( 0 ), myIndex( Bitset::npos ) {}
+
+      /// @return the current point.
+      Point operator*() const
+      { return mySet->point( myIndex ); }
+
+      /// Moves to the next point of the set.
+      /// @return a reference on itself.
+      ConstIterator & operator++()
+      { myIndex = mySet->myBits->find_next( myIndex ); return *this; }
+
+      /// Moves to the next point of the set.
+      /// @return a copy of the iterator before it moved.
+      ConstIterator operator++( int )
+      { ConstIterator tmp( *this ); ++( *this ); return tmp; }
+
+      /// @param other any iterator on the same set.
+      /// @return 'true' iff both iterators are on the same point.
+      bool operator==( const ConstIterator & other ) const
+      { return myIndex == other.myIndex; }
+
+      /// @param other any iterator on the same set.
+      /// @return 'true' iff the iterators are on different points.
+      bool operator!=( const ConstIterator & other ) const
+      { return myIndex != other.myIndex; }
+
+    private:
+      /// Constructor.
+      /// @param set the set.
+      /// @param index the index of a point of the set or Bitset::npos.
+      ConstIterator( const Self* set, std::size_t index )
+        : mySet( set ), myIndex( index ) {}
+
+      /// The set.
+      const Self* mySet;
+      /// The index of the current point, Bitset::npos past the end.
+      std::size_t myIndex;
+    };
+    typedef ConstIterator const_iterator;
+    typedef ConstIterator iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Destructor.
+    ~DomainMarkSet() {}
+
+    /// Constructor of an empty set on an empty domain.
+    DomainMarkSet();
+
+    /// Constructor of an empty set owning its bits.
+    /// @param domain the domain of the points of the set.
+    DomainMarkSet( const Domain & domain );
+
+    /// Constructor of a set aliasing the given bits. If \a bits is
+    /// empty, it is resized to the size of the domain, otherwise its
+    /// set bits are the initial points of the set.
+    /// @param domain the domain of the points of the set.
+    /// @param bits the bits of the set, one per point of the domain in
+    /// the order of the domain (aliased).
+    DomainMarkSet( const Domain & domain, Alias<Bitset> bits );
+
+    /// Copy constructor, the copy owns its bits.
+    /// @param other the object to clone.
+    DomainMarkSet( const DomainMarkSet & other );
+
+    /// Move constructor, aliased bits stay aliased.
+    /// @param other the object to move.
+    DomainMarkSet( DomainMarkSet && other );
+
+    /// Assignment, the set owns its bits afterwards.
+    /// @param other the object to copy.
+    /// @return a reference on 'this'.
+    DomainMarkSet & operator=( const DomainMarkSet & other );
+
+    /// Move assignment, aliased bits stay aliased.
+    /// @param other the object to move.
+    /// @return a reference on 'this'.
+    DomainMarkSet & operator=( DomainMarkSet && other );
+
+    /// Swaps the content with another set.
+    /// @param other any set.
+    void swap( DomainMarkSet & other );
+
+    /// @return the domain of the points of the set.
+    const Domain & domain() const
+    { return myDomain; }
+
+    /// @return the bits of the set.
+    const Bitset & bitset() const
+    { return *myBits; }
+
+    /// @return 'true' iff the bits are provided by the caller.
+    bool isAliasing() const
+    { return myBits != &myOwnBits; }
+
+    // ----------------------- Set services ------------------------------
+  public:
+
+    /// @return the number of points of the set.
+    Size size() const
+    { return mySize; }
+
+    /// @return 'true' iff the set is empty.
+    bool empty() const
+    { return mySize == 0; }
+
+    /// Removes all the points (their bits are reset).
+    void clear();
+
+    /// @param p any point of the domain.
+    /// @return 'true' iff \a p belongs to the set.
+    bool operator()( const Point & p ) const
+    { return myBits->test( index( p ) ); }
+
+    /// @param p any point of the domain.
+    /// @return 1 if \a p belongs to the set, 0 otherwise.
+    Size count( const Point & p ) const
+    { return (*this)( p ) ? 1 : 0; }
+
+    /// @param p any point of the domain.
+    /// @return an iterator on \a p if it belongs to the set, end() otherwise.
+    ConstIterator find( const Point & p ) const;
+
+    /// Inserts a point.
+    /// @param p any point of the domain.
+    /// @return an iterator on \a p and 'true' iff it was not in the set.
+    std::pair<ConstIterator, bool> insert( const Point & p );
+
+    /// Removes a point.
+    /// @param p any point of the domain.
+    /// @return the number of removed points (0 or 1).
+    Size erase( const Point & p );
+
+    /// Removes a point.
+    /// @param it any valid iterator on the set.
+    void erase( ConstIterator it );
+
+    /// @return an iterator on the first point of the set.
+    ConstIterator begin() const
+    { return ConstIterator( this, myBits->find_first() ); }
+
+    /// @return an iterator after the last point of the set.
+    ConstIterator end() const
+    { return ConstIterator( this, Bitset::npos ); }
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The domain of the points of the set.
+    Domain myDomain;
+    /// The bits owned by the set (unused when aliasing).
+    Bitset myOwnBits;
+    /// The bits of the set, either &myOwnBits or the caller's bits.
+    Bitset* myBits;
+    /// The number of points of the set.
+    Size mySize;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @param p any point of the domain.
+    /// @return the index of \a p in the bits (domain order).
+    std::size_t index( const Point & p ) const;
+
+    /// @param i any index of a point of the domain.
+    /// @return the point of index \a i.
+    Point point( std::size_t i ) const;
+
+  }; // end of class DomainMarkSet
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DomainMarkSet'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DomainMarkSet' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain>
+  std::ostream&
+  operator<< ( std::ostream & out, const DomainMarkSet<TDomain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/graph/DomainMarkSet.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DomainMarkSet_h
+
+#undef DomainMarkSet_RECURSES
+#endif // else defined(DomainMarkSet_RECURSES)
@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
@@ -69,6 +70,10 @@ namespace DGtal
    * initial core. The expander move layer by layer but the user is
    * free to navigate on each layer.
    *
+   * The points of the next layer are gathered in a buffer of the
+   * expander, which is sorted once per layer, so that moving to the
+   * next layer does not allocate once the buffer is large enough.
+   *
    * @tparam TObject the type of the digital object.
    *
    * @code
@@ -254,6 +259,12 @@ namespace DGtal
      */
     NotInCoreDomainPredicate myNotInCorePred;
 
+    /**
+     * Buffer storing the points of the next layer while it is
+     * computed, reused from one layer to the next.
+     */
+    std::vector<Point> myNewLayer;
+
     // ------------------------- Hidden services ------------------------------
   protected:
 
@@ -0,0 +1,268 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MultiSourceGeodesics.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module MultiSourceGeodesics.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MultiSourceGeodesics_RECURSES)
+#error Recursive header files inclusion detected in MultiSourceGeodesics.h
+#else // defined(MultiSourceGeodesics_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MultiSourceGeodesics_RECURSES
+
+#if !defined MultiSourceGeodesics_h
+/** Prevents repeated inclusion of headers. */
+#define MultiSourceGeodesics_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <limits>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MultiSourceGeodesics
+  /**
+     Description of template class 'MultiSourceGeodesics' <p> \brief
+     Aim: Computes geodesic distances from several sources in a graph
+     whose vertices are the indices 0, 1, ..., size()-1, such as
+     CompressedSurfelGraph (which indexes any digital surface) or
+     IndexedDigitalSurface.
+
+     The adjacencies of the graph are copied once in compressed
+     arrays, with a weight per arc: either 1 (topological distance)
+     or the Euclidean distance between the embeddings of the two
+     vertices (e.g. given by a CanonicSCellEmbedder). Distances are
+     computed by Dijkstra's algorithm with a circular bucket queue,
+     whose buckets have the width of the smallest weight, so that
+     each bucket is processed in one go without heap operations.
+
+     Two kinds of queries are provided:
+     - nearestSources computes in one pass, for each vertex, the
+       distance to its nearest source and the index of that source
+       (a geodesic Voronoi labelling);
+     - distanceMatrix computes the distances from each of some sources
+       to each of some targets, the sources being processed in
+       parallel when DGtal is built with OpenMP (WITH_OPENMP).
+
+     @code
+     typedef CompressedSurfelGraph< KSpace > Graph;
+     Graph graph( container );
+     CanonicSCellEmbedder< KSpace > embedder( K );
+     MultiSourceGeodesics< Graph > geodesics( graph );
+     geodesics.setEuclideanWeights( [&] ( Graph::Vertex v )
+                                    { return embedder( graph.surfel( v ) ); } );
+     std::vector< double > distances;
+     std::vector< MultiSourceGeodesics< Graph >::Index > labels;
+     geodesics.nearestSources( sources, distances, labels );
+     @endcode
+
+     Unreachable vertices are at distance infinity() and have label
+     InvalidIndex. The results do not depend on the number of threads.
+
+     @tparam TGraph the type of graph, a model of
+     concepts::CUndirectedSimpleLocalGraph whose vertices are
+     convertible from and to indices in [0,size()).
+     @tparam TScalar the type of distances (a floating-point type).
+   */
+  template <typename TGraph, typename TScalar = double>
+  class MultiSourceGeodesics
+  {
+  public:
+    typedef MultiSourceGeodesics<TGraph, TScalar> Self;
+    typedef TGraph                   Graph;
+    typedef TScalar                  Scalar;
+    typedef typename Graph::Vertex   Vertex;
+    typedef DGtal::uint32_t          Index;
+    typedef std::vector<Vertex>      VertexList;
+
+    /// The label of a vertex that no source reaches.
+    static const Index InvalidIndex = (Index) -1;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~MultiSourceGeodesics() {}
+
+    /**
+     * Constructor. Copies the adjacencies of the graph, with unit
+     * weights.
+     * @param graph the graph (aliased).
+     */
+    MultiSourceGeodesics( ConstAlias<Graph> graph );
+
+    /// @return the graph.
+    const Graph & graph() const
+    { return *myGraph; }
+
+    /// @return the number of vertices.
+    Index size() const
+    { return (Index) ( myOffsets.size() - 1 ); }
+
+    /// @return the distance of unreachable vertices.
+    static Scalar infinity()
+    { return std::numeric_limits<Scalar>::infinity(); }
+
+    // ----------------------- Weight services ------------------------------
+  public:
+
+    /// Sets the weight of every arc to 1, distances are then the
+    /// topological distances of the graph.
+    void setUnitWeights();
+
+    /// Sets the weight of every arc to the Euclidean distance between
+    /// the embeddings of its vertices (computed in parallel with OpenMP).
+    /// @tparam VertexEmbedder any functor Vertex -> RealPoint (a
+    /// PointVector, with a norm() method).
+    /// @param embedder the embedding of the vertices (called once per vertex).
+    template <typename VertexEmbedder>
+    void setEuclideanWeights( const VertexEmbedder & embedder );
+
+    /// @return the smallest weight of an arc (0 if there is no arc).
+    Scalar minWeight() const
+    { return myMinWeight; }
+
+    /// @return the greatest weight of an arc (0 if there is no arc).
+    Scalar maxWeight() const
+    { return myMaxWeight; }
+
+    // ----------------------- Distance services ------------------------------
+  public:
+
+    /// Computes the distances from one source to every vertex.
+    /// @param[in] source any vertex.
+    /// @param[out] distances the distance of each vertex (resized).
+    void distances( const Vertex & source, std::vector<Scalar> & distances ) const;
+
+    /// Computes in one pass the distance from every vertex to its
+    /// nearest source, and the index of this source in \a sources
+    /// (the smallest index among equidistant sources).
+    /// @param[in] sources any vertices.
+    /// @param[out] distances the distance of each vertex to its nearest source (resized).
+    /// @param[out] labels the index in \a sources of the nearest source of each vertex (resized).
+    void nearestSources( const VertexList & sources,
+                         std::vector<Scalar> & distances,
+                         std::vector<Index> & labels ) const;
+
+    /// Computes the distances from each source to each target, with
+    /// one single-source run per source (in parallel with OpenMP).
+    /// @param[in] sources any vertices.
+    /// @param[in] targets any vertices.
+    /// @param[out] matrix the distance from sources[i] to targets[j]
+    /// at index i*targets.size()+j (resized).
+    void distanceMatrix( const VertexList & sources, const VertexList & targets,
+                         std::vector<Scalar> & matrix ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// An element of the bucket queue.
+    struct Entry {
+      Index  vertex;
+      Scalar distance;
+    };
+    /// The bucket queue, reused between runs.
+    typedef std::vector< std::vector<Entry> > Buckets;
+
+    /// The graph.
+    const Graph* myGraph;
+    /// The neighbors of vertex i are myNeighbors[myOffsets[i]..myOffsets[i+1]).
+    std::vector<Index> myOffsets;
+    /// The neighbors of all the vertices.
+    std::vector<Index> myNeighbors;
+    /// The weight of each arc, parallel to myNeighbors.
+    std::vector<Scalar> myWeights;
+    /// The smallest weight.
+    Scalar myMinWeight;
+    /// The greatest weight.
+    Scalar myMaxWeight;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Updates myMinWeight and myMaxWeight from myWeights.
+    void updateWeightBounds();
+
+    /// Dijkstra's algorithm with a bucket queue, from vertices whose
+    /// distances (and labels) are already set.
+    /// @param[in,out] distances the distances, infinity() for vertices not yet reached.
+    /// @param[in,out] labels the labels, or 0 if labels are not computed.
+    /// @param[in] seeds the vertices with a finite distance.
+    /// @param[in,out] buckets the bucket queue (empty on input and output).
+    void propagate( std::vector<Scalar> & distances, std::vector<Index> * labels,
+                    const std::vector<Index> & seeds, Buckets & buckets ) const;
+
+  }; // end of class MultiSourceGeodesics
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MultiSourceGeodesics'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MultiSourceGeodesics' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TGraph, typename TScalar>
+  std::ostream&
+  operator<< ( std::ostream & out, const MultiSourceGeodesics<TGraph, TScalar> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/graph/MultiSourceGeodesics.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MultiSourceGeodesics_h
+
+#undef MultiSourceGeodesics_RECURSES
+#endif // else defined(MultiSourceGeodesics_RECURSES)
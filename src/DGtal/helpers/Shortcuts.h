@@ -1149,6 +1149,49 @@ namespace DGtal
           CountedPtr<BinaryImage> bimage,
           const KSpace&           K,
           const Parameters&       params = parametersDigitalSurface() )
+      {
+        IdxRange nb_surfels;
+        return makeLightDigitalSurfaces( surfel_reps, nb_surfels, bimage, K, params );
+      }
+
+      /// Returns a vector containing either all the light digital
+      /// surfaces in the binary image \a bimage, or any one of its big
+      /// components according to parameters, as well as their number
+      /// of surfels.
+      ///
+      /// When all components are required, the boundary surfels of the
+      /// image are extracted and labelled by connected components at
+      /// once with Surfaces::sMakeBoundaryComponents (in parallel when
+      /// DGtal is built with OpenMP), instead of tracking each
+      /// component. The components are given in increasing order of
+      /// their smallest surfel, which is their representative surfel.
+      ///
+      /// @param[out] surfel_reps a vector of surfels, one surfel per
+      /// digital surface component.
+      ///
+      /// @param[out] nb_surfels the number of surfels of each digital
+      /// surface component.
+      ///
+      /// @param[in] bimage a binary image representing the
+      /// characteristic function of a digital shape.
+      ///
+      /// @param[in] K the Khalimsky space whose domain encompasses the
+      /// digital shape.
+      ///
+      /// @param[in] params the parameters:
+      ///   - surfelAdjacency   [       0]: specifies the surfel adjacency (1:ext, 0:int)
+      ///   - nbTriesToFindABel [  100000]: number of tries in method Surfaces::findABel
+      ///   - surfaceComponents ["AnyBig"]: "AnyBig"|"All", "AnyBig": any big-enough component (> twice space width), "All": all components
+      ///
+      /// @return a vector of smart pointers to the connected (light)
+      /// digital surfaces present in the binary image.
+      static std::vector< CountedPtr<LightDigitalSurface> >
+        makeLightDigitalSurfaces
+        ( SurfelRange&            surfel_reps,
+          IdxRange&               nb_surfels,
+          CountedPtr<BinaryImage> bimage,
+          const KSpace&           K,
+          const Parameters&       params = parametersDigitalSurface() )
       {
         std::vector< CountedPtr<LightDigitalSurface> > result;
         std::string component      = params[ "surfaceComponents" ].as<std::string>();
@@ -1156,29 +1199,31 @@ namespace DGtal
           {
             result.push_back( makeLightDigitalSurface( bimage, K, params ) );
             surfel_reps.push_back( *( result[ 0 ]->begin() ) );
+            nb_surfels.push_back( result[ 0 ]->size() );
             return result;
           }	
         bool surfel_adjacency      = params[ "surfelAdjacency" ].as<int>();
         SurfelAdjacency< KSpace::dimension > surfAdj( surfel_adjacency );
-        // Extracts all boundary surfels
-        SurfelSet all_surfels;
-        Surfaces<KSpace>::sMakeBoundary( all_surfels, K, *bimage,
-                                         K.lowerBound(), K.upperBound() );
-        // Builds all connected components of surfels.
-        SurfelSet marked_surfels;
-        CountedPtr<LightDigitalSurface> ptrSurface;
-        for ( auto bel : all_surfels )
+        // Extracts all boundary surfels and their connected components.
+        SurfelRange              all_surfels;
+        std::vector<std::size_t> labels;
+        std::vector<std::size_t> sizes;
+        Surfaces<KSpace>::sMakeBoundaryComponents( all_surfels, labels, sizes,
+                                                   K, surfAdj, *bimage,
+                                                   K.lowerBound(), K.upperBound() );
+        // The first surfel with a new label is the smallest surfel
+        // of the component.
+        std::size_t nb_components = 0;
+        for ( std::size_t i = 0; i < all_surfels.size(); ++i )
           {
-            if ( marked_surfels.count( bel ) != 0 ) continue;
+            if ( labels[ i ] != nb_components ) continue;
+            const Surfel bel = all_surfels[ i ];
             surfel_reps.push_back( bel );
+            nb_surfels.push_back( sizes[ nb_components++ ] );
             LightSurfaceContainer* surfContainer
               = new LightSurfaceContainer( K, *bimage, surfAdj, bel );
-            ptrSurface = CountedPtr<LightDigitalSurface>
-              ( new LightDigitalSurface( surfContainer ) ); // acquired
-            // mark all surfels of the surface component.
-            marked_surfels.insert( ptrSurface->begin(), ptrSurface->end() );
-            // add surface component to result.
-            result.push_back( ptrSurface );
+            result.push_back( CountedPtr<LightDigitalSurface>
+                              ( new LightDigitalSurface( surfContainer ) ) ); // acquired
           }
         return result;
       }
@@ -0,0 +1,241 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BitPackedOccupancy.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module BitPackedOccupancy.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BitPackedOccupancy_RECURSES)
+#error Recursive header files inclusion detected in BitPackedOccupancy.h
+#else // defined(BitPackedOccupancy_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BitPackedOccupancy_RECURSES
+
+#if !defined BitPackedOccupancy_h
+/** Prevents repeated inclusion of headers. */
+#define BitPackedOccupancy_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "boost/dynamic_bitset.hpp"
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CSpace.h"
+#include "DGtal/topology/helpers/NeighborhoodConfigurationsHelper.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BitPackedOccupancy
+  /**
+   * Description of template class 'BitPackedOccupancy' <p> \brief
+   * Aim: Stores the occupancy of the points of a 2D or 3D box as rows
+   * of bits (one bit per point along the first axis), in order to
+   * compute quickly the neighborhood configurations of many points,
+   * as used by the simplicity tables of NeighborhoodConfigurations.h.
+   *
+   * The configuration of a point is the 8-bit (2D) or 26-bit (3D)
+   * mask of its occupied neighbors in the 3x3(x3) cube around it,
+   * ordered lexicographically as in
+   * functions::mapZeroPointNeighborhoodToConfigurationMask. Since the
+   * points of a row are consecutive bits, the three bits of a cube
+   * row are extracted with one shift of a pair of words, so that a
+   * configuration is obtained with 3 (2D) or 9 (3D) word reads and
+   * no hash table lookup. The box is surrounded by a margin of empty
+   * points, so that configurations of points on its border are
+   * valid.
+   *
+   * The batch services (configurations, isSimple) process a range of
+   * points in parallel when DGtal is built with OpenMP (WITH_OPENMP).
+   *
+   * @code
+   * BitPackedOccupancy< Z3i::Space > occupancy( domain.lowerBound(), domain.upperBound() );
+   * occupancy.insert( aSet.begin(), aSet.end() );
+   * std::vector< Z3i::Point > points( aSet.begin(), aSet.end() );
+   * std::vector< bool > simple;
+   * occupancy.isSimple( points, *table, simple ); // table from functions::loadTable
+   * @endcode
+   *
+   * @tparam TSpace any digital space of dimension 2 or 3.
+   */
+  template <typename TSpace>
+  class BitPackedOccupancy
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace< TSpace > ));
+    BOOST_STATIC_ASSERT(( TSpace::dimension == 2 || TSpace::dimension == 3 ));
+
+  public:
+    typedef BitPackedOccupancy<TSpace>  Self;
+    typedef TSpace                      Space;
+    typedef typename Space::Point       Point;
+    typedef typename Space::Integer     Integer;
+    typedef DGtal::uint64_t             Word;
+    typedef boost::dynamic_bitset<>     ConfigMap;
+
+    /// The dimension of the space.
+    static const Dimension dimension = Space::dimension;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~BitPackedOccupancy() {}
+
+    /**
+     * Constructor. All points of the box [lower,upper] are empty.
+     * @param lower the lowest point of the box.
+     * @param upper the uppermost point of the box.
+     */
+    BitPackedOccupancy( const Point & lower, const Point & upper );
+
+    /// @return the lowest point of the box.
+    const Point & lowerBound() const
+    { return myLower; }
+
+    /// @return the uppermost point of the box.
+    const Point & upperBound() const
+    { return myUpper; }
+
+    // ----------------------- Occupancy services ------------------------------
+  public:
+
+    /// Makes all points of the box empty.
+    void clear();
+
+    /// @param p any point of the box.
+    /// @return 'true' iff \a p is occupied.
+    bool test( const Point & p ) const;
+
+    /// Same as test, so that the occupancy is a model of
+    /// concepts::CPointPredicate (e.g. for DistanceTransformation).
+    /// @param p any point of the box.
+    /// @return 'true' iff \a p is occupied.
+    bool operator()( const Point & p ) const
+    { return test( p ); }
+
+    /// Sets the occupancy of a point.
+    /// @param p any point of the box.
+    /// @param occupied the new occupancy of \a p.
+    void set( const Point & p, bool occupied = true );
+
+    /// Occupies the given points.
+    /// @tparam PointIterator any model of input iterator on points.
+    /// @param itb an iterator on the first point.
+    /// @param ite an iterator after the last point.
+    template <typename PointIterator>
+    void insert( PointIterator itb, PointIterator ite );
+
+    // ----------------------- Configuration services ------------------------------
+  public:
+
+    /// @param p any point of the box.
+    /// @return the neighborhood configuration of \a p (\a p itself is not part of it).
+    NeighborhoodConfiguration configuration( const Point & p ) const;
+
+    /// Computes the neighborhood configurations of the given points
+    /// (in parallel with OpenMP).
+    /// @param[in] points any points of the box.
+    /// @param[out] configs the configuration of each point (resized).
+    void configurations( const std::vector<Point> & points,
+                         std::vector<NeighborhoodConfiguration> & configs ) const;
+
+    /// Checks the simplicity of the given points against a simplicity
+    /// table (in parallel with OpenMP).
+    /// @param[in] points any points of the box.
+    /// @param[in] table any table loaded with functions::loadTable (of the dimension of the space).
+    /// @param[out] simple 'true' at index i iff points[i] is simple (resized).
+    void isSimple( const std::vector<Point> & points, const ConfigMap & table,
+                   std::vector<bool> & simple ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// The lowest point of the box.
+    Point myLower;
+    /// The uppermost point of the box.
+    Point myUpper;
+    /// The lowest point of the box with its margin.
+    Point myOrigin;
+    /// The number of points along each axis, margin included.
+    Point myExtent;
+    /// The number of words per row (one more than needed, so that
+    /// two consecutive words may always be read).
+    std::size_t myRowSize;
+    /// The rows of bits, row (y,z) starting at word myRowSize*(y+z*myExtent[1]).
+    std::vector<Word> myWords;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @param p any point of the box (margin included).
+    /// @return the index of the first word of the row of \a p.
+    std::size_t rowIndex( const Point & p ) const;
+
+  }; // end of class BitPackedOccupancy
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BitPackedOccupancy'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BitPackedOccupancy' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const BitPackedOccupancy<TSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/BitPackedOccupancy.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BitPackedOccupancy_h
+
+#undef BitPackedOccupancy_RECURSES
+#endif // else defined(BitPackedOccupancy_RECURSES)
@@ -0,0 +1,319 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CompressedSurfelGraph.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module CompressedSurfelGraph.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(CompressedSurfelGraph_RECURSES)
+#error Recursive header files inclusion detected in CompressedSurfelGraph.h
+#else // defined(CompressedSurfelGraph_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CompressedSurfelGraph_RECURSES
+
+#if !defined CompressedSurfelGraph_h
+/** Prevents repeated inclusion of headers. */
+#define CompressedSurfelGraph_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <set>
+#include <map>
+#include <vector>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/IntegerSequenceIterator.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CompressedSurfelGraph
+  /**
+   * Description of template class 'CompressedSurfelGraph' <p> \brief
+   * Aim: Represents a frozen surfel adjacency graph in compressed
+   * sparse row (CSR) format, built once from any digital surface
+   * container, and suited for repeated graph traversals.
+   *
+   * DigitalSurface computes the neighbors of a surfel on the fly
+   * through a tracker, and IndexedDigitalSurface maps surfels to
+   * vertices with a std::map. Here, surfels are numbered with compact
+   * 32-bit indices in increasing order of surfels (the order of a
+   * std::set<SCell>), and the neighbors of all vertices are stored
+   * contiguously in one array, so that the neighbors of a vertex are
+   * obtained in O(1) as a range of indices. The mapping surfel ->
+   * index uses a sorted array of hash values (binary search).
+   *
+   * The neighbors of each vertex are given in the same order as
+   * DigitalSurface::writeNeighbors. The computation of neighbors is
+   * done in parallel when DGtal is built with OpenMP (WITH_OPENMP),
+   * each thread using its own tracker on the container. The graph
+   * does not depend on the number of threads.
+   *
+   * It is a model of concepts::CUndirectedSimpleGraph, so it can be
+   * given to BreadthFirstVisitor, DepthFirstVisitor or
+   * DistanceBreadthFirstVisitor.
+   *
+   * @code
+   * typedef DigitalSetBoundary< KSpace, DigitalSet > Container;
+   * Container container( K, aSet );
+   * CompressedSurfelGraph< KSpace > graph( container );
+   * for ( auto v : graph )
+   *   for ( auto it = graph.neighborsBegin( v ), itE = graph.neighborsEnd( v );
+   *         it != itE; ++it )
+   *     std::cout << graph.surfel( v ) << " -> " << graph.surfel( *it ) << std::endl;
+   * @endcode
+   *
+   * @tparam TKSpace the type of cellular grid space (e.g. a
+   * KhalimskySpaceND), which must be the one of the digital surface
+   * containers given to build.
+   */
+  template <typename TKSpace>
+  class CompressedSurfelGraph
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< TKSpace > ));
+
+  public:
+    typedef CompressedSurfelGraph<TKSpace>   Self;
+    typedef TKSpace                          KSpace;
+    typedef typename KSpace::Surfel          Surfel;
+    typedef typename KSpace::SCell           SCell;
+    typedef DGtal::uint32_t                  Index;
+    typedef Index                            Size;
+    typedef Index                            Vertex;
+    /// An edge is given by its two vertices.
+    typedef std::pair<Vertex, Vertex>        Edge;
+    typedef std::vector<Surfel>              SurfelStorage;
+    typedef std::vector<Index>               IndexStorage;
+    typedef IntegerSequenceIterator<Vertex>  ConstIterator;
+    /// Iterator on the neighbors of a vertex.
+    typedef typename IndexStorage::const_iterator NeighborConstIterator;
+
+    // Required for CUndirectedSimpleLocalGraph
+    typedef std::set<Vertex>                 VertexSet;
+    template <typename Value> struct         VertexMap {
+      typedef typename std::map<Vertex, Value> Type;
+    };
+
+    /// The index returned for a surfel that is not a vertex of the graph.
+    static const Index InvalidIndex = (Index) -1;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~CompressedSurfelGraph() {}
+
+    /**
+     * Constructor. The graph is empty.
+     */
+    CompressedSurfelGraph() : myOffsets( 1, 0 ) {}
+
+    /// Constructor from a digital surface container.
+    /// @tparam TDigitalSurfaceContainer any model of concepts::CDigitalSurfaceContainer over KSpace.
+    /// @param surfContainer any digital surface container (only used during the construction).
+    template <typename TDigitalSurfaceContainer>
+    CompressedSurfelGraph( const TDigitalSurfaceContainer & surfContainer )
+    {
+      build( surfContainer );
+    }
+
+    /// Clears everything.
+    void clear();
+
+    /// Builds the graph from the given digital surface container:
+    /// numbers its surfels, then computes the neighbors of every
+    /// surfel (in parallel with OpenMP).
+    ///
+    /// @tparam TDigitalSurfaceContainer any model of concepts::CDigitalSurfaceContainer over KSpace.
+    /// @param surfContainer any digital surface container (only used during the construction).
+    ///
+    /// @note there can be at most 2^32-1 surfels.
+    template <typename TDigitalSurfaceContainer>
+    void build( const TDigitalSurfaceContainer & surfContainer );
+
+    // --------------------- Undirected simple graph services -------------------------
+  public:
+
+    /// @return the number of vertices of the graph.
+    Size size() const
+    { return (Size) mySurfels.size(); }
+
+    /// @return an iterator on the first vertex (i.e. 0).
+    ConstIterator begin() const
+    { return ConstIterator( 0 ); }
+
+    /// @return an iterator after the last vertex (i.e. size()).
+    ConstIterator end() const
+    { return ConstIterator( size() ); }
+
+    /// @return the maximal number of neighbors of a vertex, i.e. 2*(n-1).
+    Size bestCapacity() const
+    { return KSpace::dimension*2 - 2; }
+
+    /// @param v any vertex.
+    /// @return the number of neighbors of \a v.
+    Size degree( const Vertex & v ) const
+    { return myOffsets[ v + 1 ] - myOffsets[ v ]; }
+
+    /// @param v any vertex.
+    /// @return an iterator on the first neighbor of \a v.
+    NeighborConstIterator neighborsBegin( const Vertex & v ) const
+    { return myNeighbors.begin() + myOffsets[ v ]; }
+
+    /// @param v any vertex.
+    /// @return an iterator after the last neighbor of \a v.
+    NeighborConstIterator neighborsEnd( const Vertex & v ) const
+    { return myNeighbors.begin() + myOffsets[ v + 1 ]; }
+
+    /**
+       Writes the neighbors of \a v with the output iterator \a it.
+
+       @tparam OutputIterator the type for the output iterator
+       (e.g. back_insert_iterator<std::vector<Vertex> >).
+
+       @param[in,out] it any output iterator on Vertex (*it++ should
+       be allowed), which is modified during the iteration.
+
+       @param[in] v any vertex of this graph
+    */
+    template <typename OutputIterator>
+    void writeNeighbors( OutputIterator & it, const Vertex & v ) const;
+
+    /**
+       Writes the neighbors of \a v, verifying the predicate \a
+       pred, with the output iterator \a it.
+
+       @tparam OutputIterator the type for the output iterator
+       (e.g. back_insert_iterator<std::vector<Vertex> >).
+
+       @tparam VertexPredicate any type of predicate taking a Vertex as input.
+
+       @param[in,out] it any output iterator on Vertex (*it++ should
+       be allowed), which is modified during the iteration.
+
+       @param[in] v any vertex of this graph
+
+       @param[in] pred the predicate for selecting neighbors.
+    */
+    template <typename OutputIterator, typename VertexPredicate>
+    void writeNeighbors( OutputIterator & it, const Vertex & v,
+                         const VertexPredicate & pred ) const;
+
+    // ----------------------- Surfel services --------------------------------
+  public:
+
+    /// @return the number of arcs of the graph (twice the number of edges).
+    Size nbArcs() const
+    { return (Size) myNeighbors.size(); }
+
+    /// @param v any vertex.
+    /// @return the surfel associated to \a v.
+    const Surfel & surfel( const Vertex & v ) const
+    { return mySurfels[ v ]; }
+
+    /// @return the surfels of the graph, sorted increasingly, such
+    /// that the i-th surfel is the one of vertex i.
+    const SurfelStorage & surfels() const
+    { return mySurfels; }
+
+    /// @param s any surfel.
+    /// @return the vertex associated to \a s, or InvalidIndex if \a s
+    /// is not a surfel of the graph.
+    /// @note O(log n) operation on integers.
+    Index index( const Surfel & s ) const;
+
+    /// @return the array of offsets (of size `size()+1`) in the array
+    /// of neighbors.
+    const IndexStorage & offsets() const
+    { return myOffsets; }
+
+    /// @return the array of neighbors of all vertices, stored contiguously.
+    const IndexStorage & neighbors() const
+    { return myNeighbors; }
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// Mapping Vertex -> Surfel (surfels are sorted increasingly).
+    SurfelStorage mySurfels;
+    /// Offsets of the neighbors of each vertex in myNeighbors (size+1 elements).
+    IndexStorage  myOffsets;
+    /// Neighbors of all vertices, stored contiguously.
+    IndexStorage  myNeighbors;
+    /// Sorted pairs (hash value of surfel, vertex) for the mapping Surfel -> Vertex.
+    std::vector< std::pair< std::size_t, Index > > myHashIndex;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+  }; // end of class CompressedSurfelGraph
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'CompressedSurfelGraph'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'CompressedSurfelGraph' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const CompressedSurfelGraph<TKSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/CompressedSurfelGraph.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CompressedSurfelGraph_h
+
+#undef CompressedSurfelGraph_RECURSES
+#endif // else defined(CompressedSurfelGraph_RECURSES)
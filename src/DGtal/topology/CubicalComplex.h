@@ -79,6 +79,21 @@ namespace DGtal
     uint32_t data;
   };
 
+  /**
+  * Customization point called by the constructor of CubicalComplex
+  * from a space, for each of its cell containers. It does nothing by
+  * default, but may be specialized for containers whose layout
+  * depends on the space (see DenseCellMap).
+  *
+  * @tparam TCellContainer the type of cell container of the complex.
+  */
+  template < typename TCellContainer >
+  struct CubicalCellContainerInitializer {
+    /// Does nothing.
+    template < typename TKSpace >
+    static void init( TCellContainer& /* container */, const TKSpace& /* K */ ) {}
+  };
+
   // Forward definitions.
   template < typename TKSpace, typename TCellContainer >
   class CubicalComplex;
@@ -398,6 +398,70 @@ namespace DGtal
                        bool hintIsSClosed = false, bool hintIsKClosed = false,
                        bool verbose = false );
 
+    /// Statistics gathered by incrementalCollapse.
+    struct CollapseStatistics {
+      /// Number of cells that may be removed (closure of the input range minus FIXED cells).
+      uint64_t nbCollapsible;
+      /// Number of cells pushed in the priority queue.
+      uint64_t nbPushed;
+      /// Number of cells popped from the priority queue.
+      uint64_t nbExamined;
+      /// Number of free pairs that were collapsed.
+      uint64_t nbPairs;
+      /// Number of removed cells (twice the number of pairs).
+      uint64_t nbRemoved;
+      /// Constructor. All counts are zero.
+      CollapseStatistics()
+        : nbCollapsible( 0 ), nbPushed( 0 ), nbExamined( 0 ),
+          nbPairs( 0 ), nbRemoved( 0 ) {}
+    };
+
+    /**
+     * Collapse a user-specified part of complex \a K, as collapse()
+     * does, but with an incremental engine: the collapsible cells are
+     * numbered once, their incidences are stored in flat arrays
+     * together with the number of remaining co-faces of each cell,
+     * and the maximal cells that have a free face are kept in an
+     * indexed heap ordered by \a priority. After each collapse, only
+     * the faces of the removed pair are examined again. The complex
+     * data is not used to tag cells, only the FIXED flag is read.
+     *
+     * The resulting complex has the same homotopy type as the input
+     * complex. Since the order of examination differs from the one of
+     * collapse(), the remaining cells may differ from the ones left by
+     * collapse().
+     *
+     * @tparam TKSpace the digital space in which lives the cubical complex.
+     * @tparam TCellContainer the associative container used to store cells within the cubical complex.
+     *
+     * @tparam CellConstIterator any forward const iterator on Cell.
+     *
+     * @tparam CellMapIteratorPriority any type defining a method 'bool
+     * operator()( const CellMapIterator&, const CellMapIterator&) const'. Defines the order
+     * in which maximal cells are collapsed. @see DefaultCellMapIteratorPriority
+     *
+     * @param[in,out] K the complex that is collapsed.
+     * @param S_itB the start of a range of cells which is included in [K].
+     * @param S_itE the end of a range of cells which is included in [K].
+     * @param priority the object that assign a priority to each cell.
+     * @param[out] stats the statistics of the collapse.
+     * @param hintIsSClosed indicates if [\a S_itb,\a S_ite) is a closed set (faster in this case).
+     * @param hintIsKClosed indicates that complex \a K is closed.
+     * @param verbose outputs some information during processing when 'true'.
+     * @return the number of cells removed from complex \a K.
+     *
+     * @note there can be at most 2^32-2 collapsible cells.
+     */
+    template <typename TKSpace, typename TCellContainer,
+              typename CellConstIterator,
+              typename CellMapIteratorPriority >
+    uint64_t incrementalCollapse( CubicalComplex< TKSpace, TCellContainer > & K,
+                                  CellConstIterator S_itB, CellConstIterator S_itE,
+                                  const CellMapIteratorPriority& priority,
+                                  CollapseStatistics& stats,
+                                  bool hintIsSClosed = false, bool hintIsKClosed = false,
+                                  bool verbose = false );
+
     /**
      * Computes the cells of the given complex \a K that lies on the
      * boundary or inside the parallelepiped specified by bounds \a
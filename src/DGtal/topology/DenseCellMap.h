@@ -0,0 +1,456 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DenseCellMap.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module DenseCellMap.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DenseCellMap_RECURSES)
+#error Recursive header files inclusion detected in DenseCellMap.h
+#else // defined(DenseCellMap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DenseCellMap_RECURSES
+
+#if !defined DenseCellMap_h
+/** Prevents repeated inclusion of headers. */
+#define DenseCellMap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ContainerTraits.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+#include "DGtal/topology/CubicalComplex.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DenseCellMap
+  /**
+   * Description of template class 'DenseCellMap' <p> \brief Aim: An
+   * associative container mapping the cells of a bounded cellular
+   * grid space to data, where cells are stored in arrays indexed
+   * directly by their Khalimsky coordinates. It is meant to be used
+   * as the cell container of a CubicalComplex that fills a large part
+   * of the bounding box of its space.
+   *
+   * Cells are grouped by their type, i.e. the parity of their
+   * Khalimsky coordinates (hence their open directions). For each
+   * type, an array of data and a bitset of membership with one entry
+   * per spel of the bounding box are allocated when the first cell of
+   * this type is inserted. Finding, inserting and erasing cells are
+   * then O(1) operations without hashing nor comparisons. Iterations
+   * skip empty 64-cell words of the bitsets. Iterators remain valid
+   * when other cells are inserted or erased, and erasing the cell of
+   * an iterator does not prevent to increment it.
+   *
+   * It is a model of pair associative, unique and unordered
+   * container (see ContainerTraits), close to std::unordered_map, but
+   * its iterators give proxies: `it->first` is the cell and
+   * `it->second` a reference to its data.
+   *
+   * A DenseCellMap must be initialized with a space (see init) before
+   * insertions. This is done automatically by the constructor of
+   * CubicalComplex from a space (see CubicalCellContainerInitializer).
+   *
+   * @code
+   * typedef DenseCellMap< KSpace >           Map;
+   * typedef CubicalComplex< KSpace, Map >    CC;
+   * CC complex( K ); // the cell containers are initialized with K.
+   * @endcode
+   *
+   * @tparam TKSpace any model of concepts::CCellularGridSpaceND (e.g. a KhalimskySpaceND).
+   * @tparam TData the type of data associated to each cell, default constructible.
+   */
+  template < typename TKSpace, typename TData = CubicalCellData >
+  class DenseCellMap
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< TKSpace > ));
+
+  public:
+    typedef DenseCellMap< TKSpace, TData >   Self;
+    typedef TKSpace                          KSpace;
+    typedef typename KSpace::Cell            Cell;
+    typedef typename KSpace::Point           Point;
+    typedef typename KSpace::Integer         Integer;
+    typedef Cell                             key_type;
+    typedef TData                            mapped_type;
+    typedef std::pair< const Cell, TData >   value_type;
+    typedef std::size_t                      size_type;
+    typedef std::ptrdiff_t                   difference_type;
+    typedef DGtal::uint64_t                  Word;
+
+    /// The dimension of the space.
+    static const Dimension dimension = KSpace::dimension;
+    /// The number of cell types (parities of Khalimsky coordinates).
+    static const unsigned int NB_TYPES = 1u << dimension;
+
+    /**
+     * The value given by the iterators of the map: a reference to a
+     * cell and a reference to its data.
+     *
+     * @tparam TDataReference either TData& or const TData&.
+     */
+    template < typename TDataReference >
+    struct ValueProxy
+    {
+      const Cell &   first;  ///< the cell.
+      TDataReference second; ///< its data.
+
+      /// Constructor from a cell and its data.
+      ValueProxy( const Cell & aCell, TDataReference aData )
+        : first( aCell ), second( aData ) {}
+      /// @return a copy of this value.
+      operator value_type() const
+      { return value_type( first, second ); }
+    };
+
+    /**
+     * Iterator on the cells of the map, in order of cell types then
+     * of Khalimsky coordinates. A model of forward iterator whose
+     * values are proxies.
+     *
+     * @tparam TMap either Self or const Self.
+     * @tparam TDataReference either TData& or const TData&.
+     */
+    template < typename TMap, typename TDataReference >
+    class IteratorBase
+    {
+      friend class DenseCellMap;
+      template < typename M, typename D > friend class IteratorBase;
+
+    public:
+      typedef std::forward_iterator_tag         iterator_category;
+      typedef typename DenseCellMap::value_type value_type;
+      typedef std::ptrdiff_t                    difference_type;
+      typedef ValueProxy< TDataReference >      reference;
+      /// Returned by operator->, for accessing the members of the proxy.
+      struct pointer {
+        reference myValue;
+        pointer( const reference & aValue ) : myValue( aValue ) {}
+        const reference* operator->() const { return &myValue; }
+      };
+
+      /// Default constructor (invalid iterator).
+      IteratorBase() : myMap( 0 ), myType( NB_TYPES ), myIndex( 0 ) {}
+
+      /// Conversion from a mutable iterator.
+      /// @param other any iterator on the same map.
+      template < typename M, typename D >
+      IteratorBase( const IteratorBase< M, D > & other )
+        : myMap( other.myMap ), myType( other.myType ),
+          myIndex( other.myIndex ), myCell( other.myCell ) {}
+
+      /// @return the proxy on the current cell and its data.
+      reference operator*() const
+      { return reference( myCell, myMap->myTypes[ myType ].data[ myIndex ] ); }
+
+      /// @return a proxy for accessing the current cell and its data.
+      pointer operator->() const
+      { return pointer( **this ); }
+
+      /// Moves to the next cell.
+      IteratorBase & operator++()
+      {
+        myMap->next( myType, myIndex );
+        if ( myType < NB_TYPES ) myCell = myMap->cell( myType, myIndex );
+        return *this;
+      }
+
+      /// Moves to the next cell.
+      IteratorBase operator++( int )
+      {
+        IteratorBase tmp( *this );
+        ++( *this );
+        return tmp;
+      }
+
+      /// @param other any iterator on the same map.
+      /// @return 'true' iff both iterators point to the same cell.
+      template < typename M, typename D >
+      bool operator==( const IteratorBase< M, D > & other ) const
+      { return myType == other.myType && myIndex == other.myIndex; }
+
+      /// @param other any iterator on the same map.
+      /// @return 'true' iff both iterators point to different cells.
+      template < typename M, typename D >
+      bool operator!=( const IteratorBase< M, D > & other ) const
+      { return ! ( *this == other ); }
+
+    private:
+      /// Constructor from a position (or end if aType is NB_TYPES).
+      IteratorBase( TMap* aMap, unsigned int aType, std::size_t anIndex )
+        : myMap( aMap ), myType( aType ), myIndex( anIndex )
+      {
+        if ( myType < NB_TYPES ) myCell = myMap->cell( myType, myIndex );
+      }
+
+      TMap*        myMap;   ///< the visited map.
+      unsigned int myType;  ///< the type of the current cell.
+      std::size_t  myIndex; ///< the index of the current cell in its type.
+      Cell         myCell;  ///< the current cell.
+    };
+
+    typedef IteratorBase< Self, TData& >                   iterator;
+    typedef IteratorBase< const Self, const TData& >       const_iterator;
+    typedef typename iterator::reference                   reference;
+    typedef typename const_iterator::reference             const_reference;
+    typedef typename iterator::pointer                     pointer;
+    typedef typename const_iterator::pointer               const_pointer;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DenseCellMap() {}
+
+    /**
+     * Default constructor. The map is not valid until init is called.
+     */
+    DenseCellMap() : mySpace( 0 ), mySize( 0 ), myNbSpels( 0 ) {}
+
+    /**
+     * Constructor from a space.
+     * @param K any bounded space (referenced, it must outlive the map).
+     */
+    DenseCellMap( const KSpace & K ) : mySpace( 0 ), mySize( 0 ), myNbSpels( 0 )
+    { init( K ); }
+
+    /**
+     * Initializes the map for the cells of the given space. The map is
+     * emptied.
+     * @param K any bounded space (referenced, it must outlive the map).
+     */
+    void init( const KSpace & K );
+
+    // ----------------------- Container services ------------------------------
+  public:
+
+    /// @return the number of cells in the map.
+    size_type size() const
+    { return mySize; }
+
+    /// @return 'true' iff the map has no cell.
+    bool empty() const
+    { return mySize == 0; }
+
+    /// @return the maximal number of cells of the map.
+    size_type max_size() const
+    { return myNbSpels * NB_TYPES; }
+
+    /// Removes all cells (the arrays are kept).
+    void clear();
+
+    /// Swaps the content of this map with \a other.
+    /// @param other any other map.
+    void swap( Self & other );
+
+    /// @return an iterator on the first cell.
+    iterator begin();
+    /// @return an iterator after the last cell.
+    iterator end()
+    { return iterator( this, NB_TYPES, 0 ); }
+    /// @return an iterator on the first cell.
+    const_iterator begin() const;
+    /// @return an iterator after the last cell.
+    const_iterator end() const
+    { return const_iterator( this, NB_TYPES, 0 ); }
+
+    /// @param aCell any cell of the space.
+    /// @return an iterator on \a aCell, or end() if it is not in the map.
+    iterator find( const Cell & aCell );
+    /// @param aCell any cell of the space.
+    /// @return an iterator on \a aCell, or end() if it is not in the map.
+    const_iterator find( const Cell & aCell ) const;
+
+    /// @param aCell any cell of the space.
+    /// @return 1 if \a aCell is in the map, 0 otherwise.
+    size_type count( const Cell & aCell ) const;
+
+    /// @param aCell any cell of the space.
+    /// @return the range of cells equal to \a aCell (empty or one cell).
+    std::pair< iterator, iterator > equal_range( const Cell & aCell );
+    /// @param aCell any cell of the space.
+    /// @return the range of cells equal to \a aCell (empty or one cell).
+    std::pair< const_iterator, const_iterator > equal_range( const Cell & aCell ) const;
+
+    /// Inserts a cell with its data, if the cell is not already in the map.
+    /// @param value a pair (cell, data).
+    /// @return an iterator on the cell and 'true' iff it was inserted.
+    std::pair< iterator, bool > insert( const value_type & value );
+
+    /// Inserts a cell with its data, if the cell is not already in the map.
+    /// @param position not used (for compatibility with other containers).
+    /// @param value a pair (cell, data).
+    /// @return an iterator on the cell.
+    iterator insert( const_iterator position, const value_type & value );
+
+    /// Inserts a range of pairs (cell, data).
+    /// @tparam InputIterator any model of input iterator on value_type.
+    /// @param it an iterator on the first pair.
+    /// @param itE an iterator after the last pair.
+    template < typename InputIterator >
+    void insert( InputIterator it, InputIterator itE );
+
+    /// @param aCell any cell of the space.
+    /// @return a reference to the data of \a aCell, which is inserted
+    /// with a default data if it was not in the map.
+    TData & operator[]( const Cell & aCell );
+
+    /// Removes a cell.
+    /// @param aCell any cell of the space.
+    /// @return the number of removed cells (0 or 1).
+    size_type erase( const Cell & aCell );
+
+    /// Removes the cell of an iterator.
+    /// @param position any valid iterator on a cell of the map.
+    /// @return an iterator on the next cell.
+    iterator erase( const_iterator position );
+
+    /// Removes the cells of a range.
+    /// @param it an iterator on the first cell to remove.
+    /// @param itE an iterator after the last cell to remove.
+    /// @return an iterator on the cell after the range.
+    iterator erase( const_iterator it, const_iterator itE );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /// The cells of one type: their data and their membership.
+    struct CellType {
+      std::vector< TData > data; ///< The data of each spel position.
+      std::vector< Word >  bits; ///< The membership of each spel position.
+    };
+
+    /// The space of the cells.
+    const KSpace* mySpace;
+    /// The number of cells in the map.
+    size_type mySize;
+    /// The (even) Khalimsky coordinates of the lowest corner.
+    Point myLower;
+    /// The number of positions along each axis.
+    Point myExtent;
+    /// The number of positions of each type.
+    std::size_t myNbSpels;
+    /// The cells of each type (allocated at the first insertion).
+    std::vector< CellType > myTypes;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Computes the type and index of a cell.
+    /// @param[in] aCell any cell of the space.
+    /// @param[out] aType the type of \a aCell.
+    /// @param[out] anIndex the index of \a aCell in its type.
+    void locate( const Cell & aCell, unsigned int & aType, std::size_t & anIndex ) const;
+
+    /// @param aType any type.
+    /// @param anIndex any index.
+    /// @return the cell of the given type and index.
+    Cell cell( unsigned int aType, std::size_t anIndex ) const;
+
+    /// @param aType any type.
+    /// @param anIndex any index.
+    /// @return 'true' iff the cell at this position is in the map.
+    bool contains( unsigned int aType, std::size_t anIndex ) const;
+
+    /// Finds the first cell from the given position (included).
+    /// @param[in,out] aType a type, which is NB_TYPES at the end.
+    /// @param[in,out] anIndex an index, which is 0 at the end.
+    void first( unsigned int & aType, std::size_t & anIndex ) const;
+
+    /// Finds the next cell after the given position (excluded).
+    /// @param[in,out] aType a type, which is NB_TYPES at the end.
+    /// @param[in,out] anIndex an index, which is 0 at the end.
+    void next( unsigned int & aType, std::size_t & anIndex ) const;
+
+  }; // end of class DenseCellMap
+
+  /**
+   * Specialization of CubicalCellContainerInitializer for DenseCellMap:
+   * the containers of a CubicalComplex are initialized with its space.
+   */
+  template < typename TKSpace, typename TData >
+  struct CubicalCellContainerInitializer< DenseCellMap< TKSpace, TData > >
+  {
+    /// Initializes \a container with the space \a K.
+    static void init( DenseCellMap< TKSpace, TData > & container, const TKSpace & K )
+    { container.init( K ); }
+  };
+
+  /// Defines container traits for DenseCellMap<>.
+  template < typename TKSpace, typename TData >
+  struct ContainerTraits< DenseCellMap< TKSpace, TData > >
+  {
+    typedef UnorderedMapAssociativeCategory Category;
+  };
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DenseCellMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DenseCellMap' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TKSpace, typename TData >
+  std::ostream&
+  operator<< ( std::ostream & out, const DenseCellMap< TKSpace, TData > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/DenseCellMap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DenseCellMap_h
+
+#undef DenseCellMap_RECURSES
+#endif // else defined(DenseCellMap_RECURSES)
@@ -0,0 +1,469 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file KhalimskyCellPacker.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module KhalimskyCellPacker.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(KhalimskyCellPacker_RECURSES)
+#error Recursive header files inclusion detected in KhalimskyCellPacker.h
+#else // defined(KhalimskyCellPacker_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define KhalimskyCellPacker_RECURSES
+
+#if !defined KhalimskyCellPacker_h
+/** Prevents repeated inclusion of headers. */
+#define KhalimskyCellPacker_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <unordered_set>
+#include <unordered_map>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // struct PackedKhalimskyCell64
+  /**
+   * Description of struct 'PackedKhalimskyCell64' <p> \brief Aim: An
+   * unsigned 3D Khalimsky cell packed into a single 64-bit word, as
+   * produced by KhalimskyCellPacker3D.
+   *
+   * Bits [21k, 21k+20] store the k-th Khalimsky coordinate (minus the
+   * bias of the packer), and bit 63 is zero.
+   */
+  struct PackedKhalimskyCell64
+  {
+    /// The packed coordinates.
+    DGtal::uint64_t code;
+
+    /// Default constructor (the cell is invalid).
+    PackedKhalimskyCell64() : code( 0 ) {}
+    /// Constructor from a code.
+    /// @param aCode any code built by a KhalimskyCellPacker3D.
+    explicit PackedKhalimskyCell64( DGtal::uint64_t aCode ) : code( aCode ) {}
+
+    /// @param other any cell.
+    /// @return 'true' iff this cell is equal to \a other.
+    bool operator==( const PackedKhalimskyCell64 & other ) const
+    { return code == other.code; }
+    /// @param other any cell.
+    /// @return 'true' iff this cell is different from \a other.
+    bool operator!=( const PackedKhalimskyCell64 & other ) const
+    { return code != other.code; }
+    /// @param other any cell.
+    /// @return 'true' iff this cell is before \a other (order of codes).
+    bool operator<( const PackedKhalimskyCell64 & other ) const
+    { return code < other.code; }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // struct PackedSignedKhalimskyCell64
+  /**
+   * Description of struct 'PackedSignedKhalimskyCell64' <p> \brief
+   * Aim: A signed 3D Khalimsky cell packed into a single 64-bit word,
+   * as produced by KhalimskyCellPacker3D.
+   *
+   * Bits [21k, 21k+20] store the k-th Khalimsky coordinate (minus the
+   * bias of the packer), and bit 63 is set iff the cell is positive.
+   */
+  struct PackedSignedKhalimskyCell64
+  {
+    /// The packed coordinates and sign.
+    DGtal::uint64_t code;
+
+    /// Default constructor (the cell is invalid).
+    PackedSignedKhalimskyCell64() : code( 0 ) {}
+    /// Constructor from a code.
+    /// @param aCode any code built by a KhalimskyCellPacker3D.
+    explicit PackedSignedKhalimskyCell64( DGtal::uint64_t aCode ) : code( aCode ) {}
+
+    /// @param other any cell.
+    /// @return 'true' iff this cell is equal to \a other.
+    bool operator==( const PackedSignedKhalimskyCell64 & other ) const
+    { return code == other.code; }
+    /// @param other any cell.
+    /// @return 'true' iff this cell is different from \a other.
+    bool operator!=( const PackedSignedKhalimskyCell64 & other ) const
+    { return code != other.code; }
+    /// @param other any cell.
+    /// @return 'true' iff this cell is before \a other (order of codes).
+    bool operator<( const PackedSignedKhalimskyCell64 & other ) const
+    { return code < other.code; }
+  };
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PackedKhalimskyCell64'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PackedKhalimskyCell64' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const PackedKhalimskyCell64 & object );
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PackedSignedKhalimskyCell64'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PackedSignedKhalimskyCell64' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const PackedSignedKhalimskyCell64 & object );
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class KhalimskyCellPacker3D
+  /**
+   * Description of template class 'KhalimskyCellPacker3D' <p> \brief
+   * Aim: Packs the cells of a 3D cellular grid space into 64-bit
+   * words and provides the usual signed and unsigned cell services
+   * (dimension, directions, incidence, adjacency) directly on packed
+   * cells, without branches nor memory accesses.
+   *
+   * The cells of KhalimskySpaceND store their Khalimsky coordinates
+   * in a PointVector (12 bytes plus a sign with 32-bit integers in
+   * 3D), which makes sets, maps and hash tables of cells expensive.
+   * Each Khalimsky coordinate is stored here on 21 bits, relatively
+   * to an even bias computed from the lower bound of the space, so
+   * spaces with up to about 10^6 spels along each axis are supported.
+   * The sign of a cell is stored in the most significant bit.
+   *
+   * Services have the same semantic as those of KhalimskySpaceND
+   * (e.g. `unpack( P.sIncident( P.pack( c ), k, up ) ) == K.sIncident( c, k, up )`),
+   * but do not check the bounds of the space, nor handle periodic
+   * dimensions. Sets and maps of packed surfels are given by the
+   * types SurfelSet and SurfelMap.
+   *
+   * @code
+   * KhalimskyCellPacker3D< KSpace > P( K );
+   * KhalimskyCellPacker3D< KSpace >::SurfelSet surfels;
+   * for ( auto s : surface ) surfels.insert( P.pack( s ) );
+   * @endcode
+   *
+   * @tparam TKSpace the type of cellular grid space of dimension 3
+   * (e.g. KhalimskySpaceND<3,int>).
+   */
+  template <typename TKSpace>
+  class KhalimskyCellPacker3D
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< TKSpace > ));
+    BOOST_STATIC_ASSERT(( TKSpace::dimension == 3 ));
+
+  public:
+    typedef KhalimskyCellPacker3D<TKSpace> Self;
+    typedef TKSpace                        KSpace;
+    typedef typename KSpace::Integer       Integer;
+    typedef typename KSpace::Point         Point;
+    typedef typename KSpace::Cell          Cell;
+    typedef typename KSpace::SCell         SCell;
+    typedef PackedKhalimskyCell64          PackedCell;
+    typedef PackedSignedKhalimskyCell64    PackedSCell;
+    typedef PackedSCell                    PackedSurfel;
+    typedef DGtal::uint64_t                Code;
+
+    /// Preferred type for defining a set of packed surfels.
+    typedef std::unordered_set<PackedSurfel> SurfelSet;
+    /// Preferred type for defining a map from packed surfels to values.
+    template <typename Value> struct SurfelMap {
+      typedef std::unordered_map<PackedSurfel, Value> Type;
+    };
+
+    /// Number of bits per Khalimsky coordinate.
+    static const unsigned int BITS = 21;
+    /// Mask of one Khalimsky coordinate.
+    static const Code COORD_MASK = ( (Code) 1 << BITS ) - 1;
+    /// Mask of the sign bit.
+    static const Code SIGN_MASK  = (Code) 1 << 63;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~KhalimskyCellPacker3D() {}
+
+    /**
+     * Constructor from a space. The bias of coordinates is computed
+     * from its lower bound.
+     * @param K any 3D cellular grid space whose Khalimsky extent is
+     * less than 2^21 along each axis (referenced, it must outlive the packer).
+     */
+    KhalimskyCellPacker3D( const KSpace & K );
+
+    // ----------------------- Conversion services ------------------------------
+  public:
+
+    /// @param c any unsigned cell of the space.
+    /// @return the corresponding packed cell.
+    PackedCell pack( const Cell & c ) const;
+
+    /// @param c any signed cell of the space.
+    /// @return the corresponding packed signed cell.
+    PackedSCell pack( const SCell & c ) const;
+
+    /// @param c any packed cell.
+    /// @return the corresponding unsigned cell of the space.
+    Cell unpack( const PackedCell & c ) const;
+
+    /// @param c any packed signed cell.
+    /// @return the corresponding signed cell of the space.
+    SCell unpack( const PackedSCell & c ) const;
+
+    /// @param c any packed signed cell.
+    /// @return the packed unsigned cell with the same coordinates.
+    static PackedCell unsigns( const PackedSCell & c )
+    { return PackedCell( c.code & ~SIGN_MASK ); }
+
+    /// @param c any packed cell.
+    /// @param positive the sign of the output cell.
+    /// @return the packed signed cell with the same coordinates and sign \a positive.
+    static PackedSCell signs( const PackedCell & c, bool positive )
+    { return PackedSCell( c.code | ( (Code) positive << 63 ) ); }
+
+    // ----------------------- Cell services ------------------------------
+  public:
+
+    /// @param c any packed cell.
+    /// @param k any direction.
+    /// @return the k-th Khalimsky coordinate of \a c.
+    Integer uKCoord( const PackedCell & c, Dimension k ) const
+    { return (Integer) ( ( c.code >> ( BITS * k ) ) & COORD_MASK ) + myBias[ k ]; }
+
+    /// @param c any packed signed cell.
+    /// @param k any direction.
+    /// @return the k-th Khalimsky coordinate of \a c.
+    Integer sKCoord( const PackedSCell & c, Dimension k ) const
+    { return (Integer) ( ( c.code >> ( BITS * k ) ) & COORD_MASK ) + myBias[ k ]; }
+
+    /// @param c any packed signed cell.
+    /// @return 'true' iff \a c is positive.
+    static bool sSign( const PackedSCell & c )
+    { return ( c.code >> 63 ) != 0; }
+
+    /// @param c any packed signed cell.
+    /// @return the cell \a c with opposite sign.
+    static PackedSCell sOpp( const PackedSCell & c )
+    { return PackedSCell( c.code ^ SIGN_MASK ); }
+
+    /// @param c any packed cell.
+    /// @return the bit mask of the open directions of \a c (bit k set
+    /// iff \a c is open along k).
+    static unsigned int uDirsMask( const PackedCell & c )
+    { return dirsMask( c.code ); }
+
+    /// @param c any packed signed cell.
+    /// @return the bit mask of the open directions of \a c (bit k set
+    /// iff \a c is open along k).
+    static unsigned int sDirsMask( const PackedSCell & c )
+    { return dirsMask( c.code ); }
+
+    /// @param c any packed cell.
+    /// @param k any direction.
+    /// @return 'true' iff \a c is open along direction \a k.
+    static bool uIsOpen( const PackedCell & c, Dimension k )
+    { return ( ( c.code >> ( BITS * k ) ) & 1 ) != 0; }
+
+    /// @param c any packed signed cell.
+    /// @param k any direction.
+    /// @return 'true' iff \a c is open along direction \a k.
+    static bool sIsOpen( const PackedSCell & c, Dimension k )
+    { return ( ( c.code >> ( BITS * k ) ) & 1 ) != 0; }
+
+    /// @param c any packed cell.
+    /// @return the dimension of \a c.
+    static Dimension uDim( const PackedCell & c )
+    { return bitCount( dirsMask( c.code ) ); }
+
+    /// @param c any packed signed cell.
+    /// @return the dimension of \a c.
+    static Dimension sDim( const PackedSCell & c )
+    { return bitCount( dirsMask( c.code ) ); }
+
+    /// @param s any packed signed surfel.
+    /// @return the direction orthogonal to \a s.
+    static Dimension sOrthDir( const PackedSCell & s )
+    { return ( ~dirsMask( s.code ) & 7 ) >> 1; }
+
+    /// @param c any packed signed cell.
+    /// @param k any direction.
+    /// @return the direct orientation of \a c along \a k (see KhalimskySpaceND::sDirect).
+    static bool sDirect( const PackedSCell & c, Dimension k )
+    { return sSign( c ) != ( ( bitCount( dirsMask( c.code ) & ( ( 2u << k ) - 1 ) ) & 1 ) != 0 ); }
+
+    // ----------------------- Neighborhood and incidence services ------------------------------
+  public:
+
+    /// @param c any packed cell.
+    /// @param k any direction.
+    /// @param up when 'true', the incident cell is above along \a k, otherwise below.
+    /// @return the cell incident to \a c along \a k (see KhalimskySpaceND::uIncident).
+    static PackedCell uIncident( const PackedCell & c, Dimension k, bool up )
+    { return PackedCell( c.code + shift( k, up ) ); }
+
+    /// @param c any packed cell.
+    /// @param k any direction.
+    /// @param up when 'true', the adjacent cell is above along \a k, otherwise below.
+    /// @return the cell adjacent to \a c along \a k (see KhalimskySpaceND::uAdjacent).
+    static PackedCell uAdjacent( const PackedCell & c, Dimension k, bool up )
+    { return PackedCell( c.code + ( shift( k, up ) << 1 ) ); }
+
+    /// @param c any packed signed cell.
+    /// @param k any direction.
+    /// @param up when 'true', the incident cell is above along \a k, otherwise below.
+    /// @return the signed cell incident to \a c along \a k (see KhalimskySpaceND::sIncident).
+    static PackedSCell sIncident( const PackedSCell & c, Dimension k, bool up );
+
+    /// @param c any packed signed cell.
+    /// @param k any direction along which \a c is open.
+    /// @return the direct incident cell of \a c along \a k (see KhalimskySpaceND::sDirectIncident).
+    static PackedSCell sDirectIncident( const PackedSCell & c, Dimension k )
+    { return sIncident( c, k, sDirect( c, k ) ); }
+
+    /// @param c any packed signed cell.
+    /// @param k any direction along which \a c is open.
+    /// @return the indirect incident cell of \a c along \a k (see KhalimskySpaceND::sIndirectIncident).
+    static PackedSCell sIndirectIncident( const PackedSCell & c, Dimension k )
+    { return sIncident( c, k, ! sDirect( c, k ) ); }
+
+    /// @param c any packed signed cell.
+    /// @param k any direction.
+    /// @param up when 'true', the adjacent cell is above along \a k, otherwise below.
+    /// @return the signed cell adjacent to \a c along \a k (see KhalimskySpaceND::sAdjacent).
+    static PackedSCell sAdjacent( const PackedSCell & c, Dimension k, bool up )
+    { return PackedSCell( c.code + ( shift( k, up ) << 1 ) ); }
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// The space of the cells.
+    const KSpace* mySpace;
+    /// The (even) Khalimsky coordinates subtracted before packing.
+    Point myBias;
+    /// 'true' iff the extent of the space fits in the packed coordinates.
+    bool  myValidity;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @param code any code.
+    /// @return the bit mask of odd coordinates of \a code.
+    static unsigned int dirsMask( Code code )
+    {
+      return (unsigned int) ( ( code & 1 )
+                              | ( ( code >> ( BITS - 1 ) ) & 2 )
+                              | ( ( code >> ( 2 * BITS - 2 ) ) & 4 ) );
+    }
+
+    /// @param m any 3-bit mask.
+    /// @return the number of bits set in \a m.
+    static Dimension bitCount( unsigned int m )
+    { return ( m & 1 ) + ( ( m >> 1 ) & 1 ) + ( ( m >> 2 ) & 1 ); }
+
+    /// @param k any direction.
+    /// @param up the direction of the move.
+    /// @return the value to add to a code to move its k-th coordinate by +1 or -1.
+    static Code shift( Dimension k, bool up )
+    { return ( (Code) 1 << ( BITS * k ) ) * (Code) ( 2 * (int) up - 1 ); }
+
+  }; // end of class KhalimskyCellPacker3D
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'KhalimskyCellPacker3D'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'KhalimskyCellPacker3D' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const KhalimskyCellPacker3D<TKSpace> & object );
+
+} // namespace DGtal
+
+namespace std {
+  /** @brief
+   * Extend std namespace to define a std::hash function on
+   * DGtal::PackedKhalimskyCell64 (a 64-bit mixing function).
+   */
+  template <>
+  struct hash< DGtal::PackedKhalimskyCell64 >
+  {
+    size_t operator()( const DGtal::PackedKhalimskyCell64 & c ) const
+    {
+      DGtal::uint64_t x = c.code;
+      x = ( x ^ ( x >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+      x = ( x ^ ( x >> 27 ) ) * 0x94d049bb133111ebULL;
+      return (size_t) ( x ^ ( x >> 31 ) );
+    }
+  };
+
+  /** @brief
+   * Extend std namespace to define a std::hash function on
+   * DGtal::PackedSignedKhalimskyCell64 (a 64-bit mixing function).
+   */
+  template <>
+  struct hash< DGtal::PackedSignedKhalimskyCell64 >
+  {
+    size_t operator()( const DGtal::PackedSignedKhalimskyCell64 & c ) const
+    {
+      DGtal::uint64_t x = c.code;
+      x = ( x ^ ( x >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+      x = ( x ^ ( x >> 27 ) ) * 0x94d049bb133111ebULL;
+      return (size_t) ( x ^ ( x >> 31 ) );
+    }
+  };
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/KhalimskyCellPacker.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined KhalimskyCellPacker_h
+
+#undef KhalimskyCellPacker_RECURSES
+#endif // else defined(KhalimskyCellPacker_RECURSES)
@@ -0,0 +1,312 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file NeighborhoodConfigurationScanner.h
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module NeighborhoodConfigurationScanner.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(NeighborhoodConfigurationScanner_RECURSES)
+#error Recursive header files inclusion detected in NeighborhoodConfigurationScanner.h
+#else // defined(NeighborhoodConfigurationScanner_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define NeighborhoodConfigurationScanner_RECURSES
+
+#if !defined NeighborhoodConfigurationScanner_h
+/** Prevents repeated inclusion of headers. */
+#define NeighborhoodConfigurationScanner_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include "boost/dynamic_bitset.hpp"
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/CSpace.h"
+#include "DGtal/topology/helpers/NeighborhoodConfigurationsHelper.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class NeighborhoodConfigurationScanner
+  /**
+   * Description of template class 'NeighborhoodConfigurationScanner' <p> \brief
+   * Aim: Visits all the points of a 2D or 3D box in lexicographic
+   * order (first axis first) and gives the neighborhood configuration
+   * of each of them with respect to a point predicate (a digital set,
+   * a thresholded image, a BitPackedOccupancy...).
+   *
+   * The configuration of a point is the 8-bit (2D) or 26-bit (3D)
+   * mask of its occupied neighbors in the 3x3(x3) cube around it,
+   * ordered lexicographically as in
+   * functions::mapZeroPointNeighborhoodToConfigurationMask. Two
+   * consecutive points of a scanline share two columns of their cubes,
+   * so the scanner keeps the 9-bit (2D) or 27-bit (3D) cube of the
+   * current point and, when moving to the next point, shifts it and
+   * only evaluates the predicate on the 3 (2D) or 9 (3D) points of the
+   * entering column, instead of on the 8 or 26 neighbors. The cube is
+   * computed from scratch at the beginning of each scanline. Points
+   * outside the box are considered empty, so the predicate is never
+   * evaluated outside of it.
+   *
+   * @code
+   * typedef NeighborhoodConfigurationScanner< Z3i::Space, Z3i::DigitalSet > Scanner;
+   * Scanner scanner( aSet, domain.lowerBound(), domain.upperBound() );
+   * for ( Scanner::ConstIterator it = scanner.begin(), itE = scanner.end(); it != itE; ++it )
+   *   if ( it.isOccupied() && (*table)[ *it ] ) // table from functions::loadTable
+   *     trace.info() << it.point() << " is simple." << std::endl;
+   * @endcode
+   *
+   * The batch services (configurations, selectPoints) process the
+   * scanlines in parallel when DGtal is built with OpenMP
+   * (WITH_OPENMP), the predicate being then evaluated concurrently.
+   *
+   * @tparam TSpace any digital space of dimension 2 or 3.
+   * @tparam TPointPredicate any model of point predicate on the points of \a TSpace.
+   */
+  template <typename TSpace, typename TPointPredicate>
+  class NeighborhoodConfigurationScanner
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace< TSpace > ));
+    BOOST_STATIC_ASSERT(( TSpace::dimension == 2 || TSpace::dimension == 3 ));
+
+  public:
+    typedef NeighborhoodConfigurationScanner<TSpace, TPointPredicate> Self;
+    typedef TSpace                      Space;
+    typedef TPointPredicate             PointPredicate;
+    typedef typename Space::Point       Point;
+    typedef typename Space::Integer     Integer;
+    typedef boost::dynamic_bitset<>     ConfigMap;
+
+    /// The dimension of the space.
+    static const Dimension dimension = Space::dimension;
+
+    /**
+     * A forward iterator visiting the points of the box in
+     * lexicographic order, whose value is the neighborhood
+     * configuration of the current point.
+     */
+    class ConstIterator
+    {
+      friend class NeighborhoodConfigurationScanner<TSpace, TPointPredicate>;
+    public:
+      typedef std::forward_iterator_tag         iterator_category;
+      typedef NeighborhoodConfiguration         value_type;
+      typedef std::ptrdiff_t                    difference_type;
+      typedef const NeighborhoodConfiguration*  pointer;
+      typedef NeighborhoodConfiguration         reference;
+
+      /// Default constructor (invalid iterator).
+      ConstIterator() : myScanner( 0 ), myCube( 0 ), myEnd( true ) {}
+
+      /// @return the neighborhood configuration of the current point.
+      NeighborhoodConfiguration operator*() const
+      { return myScanner->removeCenter( myCube ); }
+
+      /// @return the current point.
+      const Point & point() const
+      { return myPoint; }
+
+      /// @return 'true' iff the current point satisfies the predicate.
+      bool isOccupied() const
+      { return ( ( myCube >> myScanner->centerBit() ) & 1 ) != 0; }
+
+      /// Moves to the next point of the box.
+      /// @return a reference on itself.
+      ConstIterator & operator++();
+
+      /// Moves to the next point of the box.
+      /// @return a copy of the iterator before it moved.
+      ConstIterator operator++( int )
+      { ConstIterator tmp( *this ); ++( *this ); return tmp; }
+
+      /// @param other any iterator on the same scanner.
+      /// @return 'true' iff both iterators are on the same point.
+      bool operator==( const ConstIterator & other ) const
+      { return myEnd == other.myEnd && ( myEnd || myPoint == other.myPoint ); }
+
+      /// @param other any iterator on the same scanner.
+      /// @return 'true' iff the iterators are on different points.
+      bool operator!=( const ConstIterator & other ) const
+      { return ! ( *this == other ); }
+
+    private:
+      /// The scanner.
+      const Self* myScanner;
+      /// The current point.
+      Point myPoint;
+      /// The 9-bit (2D) or 27-bit (3D) cube around the current point.
+      DGtal::uint32_t myCube;
+      /// 'true' iff past the last point.
+      bool myEnd;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~NeighborhoodConfigurationScanner() {}
+
+    /**
+     * Constructor.
+     * @param predicate the point predicate giving the occupied points (aliased).
+     * @param lower the lowest point of the box.
+     * @param upper the uppermost point of the box.
+     */
+    NeighborhoodConfigurationScanner( ConstAlias<PointPredicate> predicate,
+                                      const Point & lower, const Point & upper );
+
+    /// @return the lowest point of the box.
+    const Point & lowerBound() const
+    { return myLower; }
+
+    /// @return the uppermost point of the box.
+    const Point & upperBound() const
+    { return myUpper; }
+
+    /// @return the number of points of the box.
+    std::size_t size() const;
+
+    /// @return an iterator on the first point of the box.
+    ConstIterator begin() const;
+
+    /// @return an iterator after the last point of the box.
+    ConstIterator end() const;
+
+    // ----------------------- Batch services ------------------------------
+  public:
+
+    /// Computes the neighborhood configurations of all the points of
+    /// the box (in parallel with OpenMP).
+    /// @param[out] configs the configuration of each point of the box,
+    /// in lexicographic order (resized).
+    void configurations( std::vector<NeighborhoodConfiguration> & configs ) const;
+
+    /// Outputs the occupied points of the box whose configuration is
+    /// set in the given table, e.g. the simple points of the
+    /// predicate for a simplicity table (in parallel with OpenMP).
+    /// @param[in] table any table loaded with functions::loadTable (of the dimension of the space).
+    /// @param[out] points the selected points, in lexicographic order (cleared first).
+    void selectPoints( const ConfigMap & table, std::vector<Point> & points ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// The point predicate.
+    const PointPredicate* myPredicate;
+    /// The lowest point of the box.
+    Point myLower;
+    /// The uppermost point of the box.
+    Point myUpper;
+    /// Maps the bits of a column (one per point) to their place in
+    /// the last column of a cube.
+    std::vector<DGtal::uint32_t> mySpread;
+    /// The bits of the first two columns of a cube.
+    DGtal::uint32_t myKeepMask;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @return the number of points of a column (3 or 9).
+    static unsigned int columnSize()
+    { return dimension == 3 ? 9 : 3; }
+
+    /// @return the index of the center of a cube (4 or 13).
+    static unsigned int centerBit()
+    { return dimension == 3 ? 13 : 4; }
+
+    /// @param cube a 9-bit (2D) or 27-bit (3D) cube.
+    /// @return the configuration, i.e. the cube without its center.
+    static NeighborhoodConfiguration removeCenter( DGtal::uint32_t cube );
+
+    /// @param p any point, whose first coordinate gives the column.
+    /// @return the occupancy of the column of points p + (0,dy,dz),
+    /// as a mask where bit (dy+1)+3(dz+1) is set iff that point is in
+    /// the box and satisfies the predicate.
+    DGtal::uint32_t column( Point p ) const;
+
+    /// @param p any point of the box.
+    /// @return the cube around \a p, computed from scratch.
+    DGtal::uint32_t cube( const Point & p ) const;
+
+    /// @param cube the cube around a point p.
+    /// @param p the point after the point of \a cube along the first axis.
+    /// @return the cube around \a p.
+    DGtal::uint32_t slide( DGtal::uint32_t cube, const Point & p ) const;
+
+    /// @return the number of scanlines of the box.
+    std::size_t nbRows() const;
+
+    /// @param r the index of a scanline.
+    /// @return the first point of the scanline.
+    Point rowStart( std::size_t r ) const;
+
+  }; // end of class NeighborhoodConfigurationScanner
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'NeighborhoodConfigurationScanner'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'NeighborhoodConfigurationScanner' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace, typename TPointPredicate>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const NeighborhoodConfigurationScanner<TSpace, TPointPredicate> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/NeighborhoodConfigurationScanner.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined NeighborhoodConfigurationScanner_h
+
+#undef NeighborhoodConfigurationScanner_RECURSES
+#endif // else defined(NeighborhoodConfigurationScanner_RECURSES)
@@ -47,6 +47,8 @@
 #include <iostream>
 #include <string>
 #include <map>
+#include <vector>
+#include <type_traits>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CowPtr.h"
 #include "DGtal/base/CountedPtr.h"
@@ -624,6 +626,21 @@ objects[ 0 ].writeComponents( it ); // it points in same container as this.
         const boost::dynamic_bitset<> & input_table,
 	const std::unordered_map< Point,
 	  NeighborhoodConfiguration > & mapZeroNeighborhoodToMask) const;
+
+    /**
+     * Checks the simplicity of many points at once.
+     *
+     * If a table is set (@ref Object::setTable) and the dimension is
+     * 2 or 3, the object is copied into a BitPackedOccupancy, from
+     * which the neighborhood configurations of all points are computed
+     * with word operations (in parallel with OpenMP). Otherwise, it
+     * calls isSimple on each point.
+     *
+     * @param[in] points any points of the domain of the object.
+     * @param[out] simple 'true' at index i iff points[i] is simple (resized).
+     */
+    void isSimple( const std::vector<Point> & points,
+                   std::vector<bool> & simple ) const;
     // ----------------------- Interface --------------------------------------
   public:
 
@@ -639,6 +656,16 @@ objects[ 0 ].writeComponents( it ); // it points in same container as this.
      */
     bool isValid() const;
 
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Batch isSimple with the table, in dimension 2 or 3.
+    void isSimpleFromTable( const std::vector<Point> & points,
+                            std::vector<bool> & simple, std::true_type ) const;
+    /// Batch isSimple with the table, in other dimensions (point by point).
+    void isSimpleFromTable( const std::vector<Point> & points,
+                            std::vector<bool> & simple, std::false_type ) const;
+
     // ------------------------- Protected Datas ------------------------------
   private:
     // ------------------------- Private Datas --------------------------------
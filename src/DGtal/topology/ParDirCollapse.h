@@ -119,6 +119,10 @@ public:
      /**
      * This method applies a given number of iterations to a complex
      * provided by the attach() method.
+     * The free pairs of each direction/orientation sub-step are
+     * searched in parallel when DGtal is built with OpenMP
+     * (WITH_OPENMP); the result does not depend on the number of
+     * threads.
      * @param iterations -- number of iterations
      * @return total number of removed cells.
      */
@@ -181,6 +185,15 @@ private:
      */
     bool isIsthmus ( CellMapConstIterator F );
 
+    /**
+     * Marks as FIXED the faces of dimension KSpace::dimension - 1 that
+     * are not included in any face of dimension KSpace::dimension
+     * (and that are isthmuses if \a onlyIsthmus is true). Faces are
+     * tested in parallel with OpenMP.
+     * @param onlyIsthmus -- when true, only isthmuses are fixed.
+     */
+    void fixCells ( bool onlyIsthmus );
+
     // ------------------------- Hidden services ------------------------------
 protected:
     /**
@@ -44,6 +44,7 @@
 #include <DGtal/topology/CubicalComplex.h>
 #include <DGtal/topology/DigitalTopology.h>
 #include <DGtal/topology/Object.h>
+#include <DGtal/topology/BitPackedOccupancy.h>
 
 namespace DGtal {
 
@@ -399,6 +400,22 @@ class VoxelComplex : public CubicalComplex<TKSpace, TCellContainer> {
      */
     bool isSimple(const Cell &input_spel) const;
 
+    /**
+     * Check the simplicity of many spels at once.
+     *
+     * If a table is loaded, the spels of the complex are copied into a
+     * BitPackedOccupancy, from which the neighborhood configurations of
+     * all input spels are computed with word operations (in parallel
+     * with OpenMP). Otherwise, isSimpleByThinning is used on each spel.
+     *
+     * @param[in] input_spels spels of the khalimsky space.
+     * @param[out] simple true at index i iff input_spels[i] is simple
+     * (resized).
+     * @see isSimple
+     */
+    void isSimple(const std::vector<Cell> &input_spels,
+                  std::vector<bool> &simple) const;
+
     //------ Cliques ------//
     // Cliques, union of adjacent spels.
     // The intersection of all spels of the clique define the type.
@@ -465,7 +482,10 @@ class VoxelComplex : public CubicalComplex<TKSpace, TCellContainer> {
      * @return CliqueContainer with the computed cliques for the specified
      * dimension.
      *
-     * @note it uses OpenMP if available.
+     * @note The cells are processed by blocks of fixed size, in
+     * parallel if DGtal is built with OpenMP (WITH_OPENMP). Cliques
+     * are always returned in the order of the cells of \a cubical, so
+     * the output does not depend on the number of threads.
      */
     CliqueContainer criticalCliquesForD(const Dimension d,
                                         const Parent &cubical,
@@ -42,6 +42,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <functional>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/topology/VoxelComplex.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -81,6 +83,87 @@ namespace DGtal
        uint32_t persistence,
        bool verbose = false
     );
+
+    /**
+     * Evaluates the skeleton function \a Skel on the given voxels of
+     * \a vc, and returns the voxels for which it is true. The
+     * voxels are processed by blocks of fixed size, in parallel if
+     * DGtal is built with OpenMP (WITH_OPENMP), and the output is
+     * given in the order of \a cells whatever the number of threads.
+     * Used by the thinning schemes.
+     *
+     * @note \a Skel is called concurrently on the same const complex,
+     * it must not modify a shared state.
+     *
+     * @tparam TComplex VoxelComplex
+     * @param vc input voxel complex.
+     * @param cells voxels of \a vc to check.
+     * @param Skel skeleton function (e.g. @ref skelIsthmus).
+     *
+     * @return the voxels of \a cells that belong to the skeleton.
+     */
+    template < typename TComplex >
+    std::vector<typename TComplex::Cell>
+    skelCells(
+       const TComplex & vc ,
+       const std::vector<typename TComplex::Cell> & cells ,
+       std::function<
+       bool(
+         const TComplex & ,
+         const typename TComplex::Cell & )
+       > Skel
+    );
+
+    /**
+     * Distance-ordered skeletonization of the voxels of \a vc.
+     *
+     * The distance of each voxel is read once in \a dist_map and
+     * replaced by its rank among the distinct distances. The
+     * occupancy of the voxels is kept in a BitPackedOccupancy. Voxels
+     * are then processed by increasing distance with a bucket queue:
+     * at each distance, the voxels of the bucket whose configuration
+     * is true in \a skelTable are first marked as anchors
+     * (configurations are computed in batch, in parallel with OpenMP),
+     * then the other ones are removed one by one when they are
+     * simple. The neighbors of a removed voxel are queued again, at
+     * their distance or at the current one if it is greater.
+     *
+     * The result is a voxel complex with the same topology as \a vc,
+     * in which remaining voxels are either anchors or non-simple. It
+     * is deterministic.
+     *
+     * @code
+     * using L2Metric = ExactPredicateLpSeparableMetric<Z3i::Space, 2>;
+     * using DT = DistanceTransformation<Z3i::Space, Z3i::DigitalSet, L2Metric>;
+     * DT dt( set.domain(), set, L2Metric() );
+     * auto isthmus_table = *functions::loadTable( isthmusicity::tableOneIsthmus );
+     * auto skeleton = functions::distanceOrderedSkeleton( vc, isthmus_table, dt );
+     * @endcode
+     *
+     * @tparam TComplex VoxelComplex (3D)
+     * @tparam TDistanceMap map from the voxel points to ordered values
+     * of type TDistanceMap::Value, e.g. a DistanceTransformation.
+     * @param vc input voxel complex, with a loaded simplicity table
+     * (e.g. simplicity::tableSimple26_6, see setSimplicityTable).
+     * @param skelTable table[conf]->bool of voxels to keep in the
+     * skeleton (e.g. isthmusicity::tableOneIsthmus for curve
+     * skeletons, an all-false table for ultimate skeletons).
+     * @param dist_map distance of the voxels to the background.
+     * @param verbose print messages.
+     *
+     * @return the skeleton, as a closed voxel complex sharing the
+     * simplicity table of \a vc.
+     * @throw std::runtime_error if no simplicity table is loaded in \a vc.
+     */
+    template < typename TComplex, typename TDistanceMap >
+    TComplex
+    distanceOrderedSkeleton(
+       const TComplex & vc ,
+       const boost::dynamic_bitset<> & skelTable,
+       const TDistanceMap & dist_map,
+       bool verbose = false
+    );
+
 //////////////////////////////////////////////////////////////////////////////
 // Select Functions
     /**
@@ -41,6 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <atomic>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Exceptions.h"
 #include "DGtal/topology/SurfelAdjacency.h"
@@ -88,6 +90,7 @@ namespace DGtal
     typedef typename KSpace::Surfel      Surfel;
     typedef typename KSpace::DirIterator DirIterator;
     typedef std::vector<Cell>            CellRange;
+    typedef std::vector<SCell>           SCellRange;
     
     // ----------------------- Static services ------------------------------
   public:
@@ -776,6 +779,120 @@ namespace DGtal
                          const PointPredicate & pp,
                          const Point & aLowerBound, 
                          const Point & aUpperBound  );
+
+    /**
+       Fills the vector @a aBoundary with the unsigned surfels of the
+       digital shape described by the predicate [pp], sorted in
+       increasing order (i.e. the order of a std::set<Cell>).
+
+       Contrary to uMakeBoundary, the extraction is done line by line
+       along the first axis: the predicate is evaluated once per spel
+       and line buffers are compared to detect boundary elements. The
+       domain is cut in slabs along the last axis, which are processed
+       in parallel when DGtal is built with OpenMP (WITH_OPENMP). Each
+       slab writes into its own buffer and buffers are concatenated in
+       slab order, so the output does not depend on the number of
+       threads.
+
+       @tparam PointPredicate a model of concepts::CPointPredicate
+       describing the inside of a digital shape. It must be safe to
+       call concurrently when OpenMP is enabled (images and digital
+       sets are).
+
+       @param[out] aBoundary the vector of surfels (cleared first).
+
+       @param aKSpace any space.
+       @param pp an instance of a model of concepts::CPointPredicate, for
+       instance a binary image or a digital set representing a shape.
+
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+    */
+    template <typename PointPredicate>
+    static
+    void uMakeSortedBoundary( CellRange & aBoundary,
+                              const KSpace & aKSpace,
+                              const PointPredicate & pp,
+                              const Point & aLowerBound,
+                              const Point & aUpperBound );
+
+    /**
+       Fills the vector @a aBoundary with the signed surfels of the
+       digital shape described by the predicate [pp], sorted in
+       increasing order (i.e. the order of a std::set<SCell>). The
+       result contains exactly the surfels given by sMakeBoundary and
+       may be given as is to Shortcuts::makeIdxDigitalSurface or to an
+       ExplicitDigitalSurface.
+
+       See uMakeSortedBoundary for details on the scanline and
+       parallel extraction.
+
+       @tparam PointPredicate a model of concepts::CPointPredicate
+       describing the inside of a digital shape.
+
+       @param[out] aBoundary the vector of signed surfels (cleared first).
+
+       @param aKSpace any space.
+       @param pp an instance of a model of concepts::CPointPredicate, for
+       instance a binary image or a digital set representing a shape.
+
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+    */
+    template <typename PointPredicate>
+    static
+    void sMakeSortedBoundary( SCellRange & aBoundary,
+                              const KSpace & aKSpace,
+                              const PointPredicate & pp,
+                              const Point & aLowerBound,
+                              const Point & aUpperBound );
+
+    /**
+       Extracts the signed surfels of the digital shape described by
+       the predicate [pp] (as sMakeSortedBoundary) and labels them
+       according to the connected component of the surfel adjacency
+       [surfel_adj] they belong to.
+
+       Components are computed with a lock-free union-find over the
+       sorted surfels, where each surfel is linked to its adjacent
+       surfels. The neighbors of surfels are computed in parallel when
+       DGtal is built with OpenMP (WITH_OPENMP). Since a component is
+       always represented by its smallest surfel, the output does not
+       depend on the number of threads: components are numbered in
+       increasing order of their smallest surfel, which is also the
+       first surfel of aBoundary having this label.
+
+       @tparam PointPredicate a model of concepts::CPointPredicate
+       describing the inside of a digital shape.
+
+       @param[out] aBoundary the sorted vector of signed surfels (cleared first).
+
+       @param[out] aLabels the component number of each surfel of
+       aBoundary (same size as aBoundary).
+
+       @param[out] aSizes the number of surfels of each component.
+
+       @param aKSpace any space.
+       @param surfel_adj the surfel adjacency (which determines
+       whether an interior or exterior turn is prioritized).
+       @param pp an instance of a model of concepts::CPointPredicate, for
+       instance a binary image or a digital set representing a shape.
+
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+
+       @return the number of connected components.
+    */
+    template <typename PointPredicate>
+    static
+    std::size_t sMakeBoundaryComponents( SCellRange & aBoundary,
+                                         std::vector<std::size_t> & aLabels,
+                                         std::vector<std::size_t> & aSizes,
+                                         const KSpace & aKSpace,
+                                         const SurfelAdjacency<KSpace::dimension> & surfel_adj,
+                                         const PointPredicate & pp,
+                                         const Point & aLowerBound,
+                                         const Point & aUpperBound );
     
 
     
@@ -914,6 +1031,49 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /// Builds the unsigned surfel between spel \a p and spel \a p + e_k.
+    struct UnsignedBoundaryCellMaker {
+      typedef Cell Value;
+      Cell operator()( const KSpace & K, const Point & p,
+                       Dimension k, bool /* in_here */ ) const
+      { return K.uIncident( K.uSpel( p ), k, true ); }
+    };
+
+    /// Builds the signed surfel between spel \a p and spel \a p + e_k.
+    struct SignedBoundaryCellMaker {
+      typedef SCell Value;
+      SCell operator()( const KSpace & K, const Point & p,
+                        Dimension k, bool in_here ) const
+      { return K.sIncident( K.sSpel( p, in_here ), k, true ); }
+    };
+
+    /**
+       Scanline boundary extraction shared by uMakeSortedBoundary and
+       sMakeSortedBoundary.
+
+       @tparam CellMaker either UnsignedBoundaryCellMaker or SignedBoundaryCellMaker.
+    */
+    template <typename CellMaker, typename PointPredicate>
+    static
+    void makeSortedBoundary( std::vector<typename CellMaker::Value> & aBoundary,
+                             const KSpace & aKSpace,
+                             const PointPredicate & pp,
+                             const Point & aLowerBound,
+                             const Point & aUpperBound );
+
+    /// Union-find structure shared by threads: the parent of each element.
+    typedef std::vector< std::atomic<std::size_t> > ConcurrentParents;
+
+    /// @return the root of element \a x in \a parents (with path halving).
+    static
+    std::size_t concurrentFind( ConcurrentParents & parents, std::size_t x );
+
+    /// Merges the sets of \a x and \a y in \a parents. The root
+    /// of the merged set is the smallest of both roots.
+    static
+    void concurrentUnite( ConcurrentParents & parents,
+                          std::size_t x, std::size_t y );
+
   }; // end of class Surfaces
 
 
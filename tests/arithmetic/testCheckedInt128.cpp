@@ -0,0 +1,205 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testCheckedInt128.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class CheckedInt128.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#include <cstdlib>
+#include "DGtalCatch.h"
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/arithmetic/CheckedInt128.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/geometry/surfaces/COBANaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/ChordNaivePlaneComputer.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+#ifdef DGTAL_HAS_INT128
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class CheckedInt128.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef CheckedInt128 Integer;
+
+/// 2^e as a CheckedInt128.
+Integer power2( unsigned int e )
+{
+  Integer r( 1 );
+  for ( unsigned int i = 0; i < e; ++i ) r *= Integer( 2 );
+  return r;
+}
+
+/**
+ * Recognizes random points of the naive plane d <= ax+by+cz < d+c
+ * (with c the largest coefficient) with a plane computer, then checks
+ * that the point just above the last one is rejected.
+ */
+template <typename PlaneComputer>
+bool checkPlane( PlaneComputer & plane,
+                 Integer a, Integer b, Integer c, Integer d,
+                 int diameter, unsigned int nbpoints )
+{
+  typedef typename PlaneComputer::Point Point;
+  IntegerComputer<Integer> ic;
+  Point p;
+  for ( unsigned int i = 0; i < nbpoints; ++i )
+    {
+      p[ 0 ] = ( rand() % ( 2 * diameter - 1 ) ) - diameter + 1;
+      p[ 1 ] = ( rand() % ( 2 * diameter - 1 ) ) - diameter + 1;
+      Integer z = ic.ceilDiv( d - a * Integer( p[ 0 ] ) - b * Integer( p[ 1 ] ), c );
+      p[ 2 ] = static_cast<int>( z.toInt64() );
+      if ( ! plane.extend( p ) ) return false;
+    }
+  // A naive plane along z has exactly one point per (x,y) column.
+  p[ 2 ] += 1;
+  return ! plane.isExtendable( p );
+}
+
+TEST_CASE( "Testing CheckedInt128" )
+{
+  BOOST_CONCEPT_ASSERT(( concepts::CInteger<Integer> ));
+
+  SECTION( "Arithmetic agrees with 64-bit integers" )
+    {
+      srand( 0 );
+      unsigned int nbok = 0;
+      const unsigned int nb = 10000;
+      for ( unsigned int i = 0; i < nb; ++i )
+        {
+          DGtal::int64_t x = ( rand() % 2000001 ) - 1000000;
+          DGtal::int64_t y = ( rand() % 2000001 ) - 1000000;
+          if ( y == 0 ) y = 7;
+          Integer a( x ), b( y );
+          bool ok = ( a + b ).toInt64() == x + y
+            && ( a - b ).toInt64() == x - y
+            && ( a * b ).toInt64() == x * y
+            && ( a / b ).toInt64() == x / y
+            && ( a % b ).toInt64() == x % y
+            && ( -a ).toInt64() == -x
+            && ( a < b ) == ( x < y ) && ( a <= b ) == ( x <= y )
+            && ( a == b ) == ( x == y ) && ( a != b ) == ( x != y );
+          nbok += ok ? 1 : 0;
+        }
+      REQUIRE( nbok == nb );
+      Integer c( 5 );
+      REQUIRE( ( c++ ) == 5 );
+      REQUIRE( ( ++c ) == 7 );
+      REQUIRE( ( --c ) == 6 );
+      REQUIRE( NumberTraits<Integer>::even( c ) );
+      REQUIRE( NumberTraits<Integer>::odd( c + 1 ) );
+      REQUIRE( NumberTraits<Integer>::castToDouble( power2( 100 ) ) == std::ldexp( 1.0, 100 ) );
+    }
+
+  SECTION( "Values beyond 64 bits" )
+    {
+      Integer big = power2( 100 ) + Integer( 12345 );
+      REQUIRE( big.isNative() );
+      REQUIRE( ( big * Integer( 3 ) - big - big - big ) == 0 );
+      REQUIRE( ( big / power2( 90 ) ) == 1024 );
+      REQUIRE( ( big % power2( 90 ) ) == 12345 );
+      REQUIRE( ( -big ).sign() == -1 );
+      REQUIRE( power2( 64 ).toInt64() == 0 );
+      std::ostringstream out;
+      out << power2( 100 ) << " " << -power2( 70 );
+      REQUIRE( out.str() == "1267650600228229401496703205376 -1180591620717411303424" );
+      std::istringstream in( out.str() );
+      Integer u, v;
+      in >> u >> v;
+      REQUIRE( u == power2( 100 ) );
+      REQUIRE( v == -power2( 70 ) );
+      IntegerComputer<Integer> ic;
+      Integer g = ic.gcd( power2( 80 ) * Integer( 15 ), power2( 70 ) * Integer( 21 ) );
+      REQUIRE( g == power2( 70 ) * Integer( 3 ) );
+      REQUIRE( ic.floorDiv( -power2( 90 ) - Integer( 1 ), power2( 80 ) ) == -1025 );
+      REQUIRE( ic.ceilDiv( power2( 90 ) + Integer( 1 ), power2( 80 ) ) == 1025 );
+    }
+
+  SECTION( "Overflows are detected" )
+    {
+      Integer max = NumberTraits<Integer>::max();
+      Integer min = NumberTraits<Integer>::min();
+      REQUIRE( min + max == -1 );
+      REQUIRE( ( max - Integer( 1 ) ) + Integer( 1 ) == max );
+      REQUIRE( ( min + Integer( 1 ) ) - Integer( 1 ) == min );
+      REQUIRE( min / Integer( 1 ) == min );
+      REQUIRE( ( min % Integer( -1 ) ) == 0 );
+      REQUIRE( power2( 63 ) * power2( 63 ) == power2( 126 ) );
+      REQUIRE( -power2( 63 ) * power2( 64 ) == min );
+#ifdef WITH_BIGINTEGER
+      Integer over = max + Integer( 1 );
+      REQUIRE( ! over.isNative() );
+      REQUIRE( over.isValid() );
+      REQUIRE( over - Integer( 1 ) == max );
+      REQUIRE( ( over - Integer( 1 ) ).isNative() );
+      REQUIRE( power2( 200 ) / power2( 150 ) == power2( 50 ) );
+      REQUIRE( ( power2( 200 ) / power2( 150 ) ).isNative() );
+      REQUIRE( -min > max );
+      REQUIRE( min / Integer( -1 ) == over );
+      REQUIRE( power2( 200 ).toString() == power2( 200 ).toBigInteger().get_str() );
+#else
+      REQUIRE_THROWS_AS( max + Integer( 1 ), std::overflow_error );
+      REQUIRE_THROWS_AS( min - Integer( 1 ), std::overflow_error );
+      REQUIRE_THROWS_AS( -min, std::overflow_error );
+      REQUIRE_THROWS_AS( power2( 64 ) * power2( 64 ), std::overflow_error );
+      REQUIRE_THROWS_AS( min / Integer( -1 ), std::overflow_error );
+#endif
+    }
+}
+
+TEST_CASE( "Plane computers with CheckedInt128" )
+{
+  // Such diameters are out of reach of int64_t for the COBA algorithm.
+  srand( 0 );
+  const int diameter = 5000;
+  for ( unsigned int j = 0; j < 5; ++j )
+    {
+      Integer a( rand() % ( diameter / 2 ) );
+      Integer b( rand() % ( diameter / 2 ) );
+      Integer c( diameter / 2 + rand() % ( diameter / 2 ) );
+      Integer d( rand() % ( diameter / 2 ) );
+      CAPTURE( a ); CAPTURE( b ); CAPTURE( c ); CAPTURE( d );
+
+      COBANaivePlaneComputer<Z3i::Space, Integer> coba;
+      coba.init( 2, diameter, 1, 1 );
+      REQUIRE( checkPlane( coba, a, b, c, d, diameter, 100 ) );
+
+      ChordNaivePlaneComputer<Z3i::Space, Z3i::Point, Integer> chord;
+      chord.init( 2, 1, 1 );
+      REQUIRE( checkPlane( chord, a, b, c, d, diameter, 100 ) );
+    }
+}
+
+#endif // DGTAL_HAS_INT128
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
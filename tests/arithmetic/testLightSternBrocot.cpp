@@ -30,6 +30,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <cstdlib>
 #include <iostream>
+#include <vector>
 #include <map>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CPointPredicate.h"
@@ -757,6 +758,51 @@ testAncestors()
   return D1.slope() == Fraction( 1, 1 );
 }
 
+/**
+   Computes fractions and their descendants concurrently (with
+   OpenMP), then checks that they are the nodes computed sequentially.
+*/
+template <typename SB>
+bool
+testConcurrentFractions()
+{
+  typedef typename SB::Integer Integer;
+  typedef typename SB::Fraction Fraction;
+  const long N = 5000;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: concurrent fractions." );
+  srand( 7 );
+  std::vector<Integer> P( N ), Q( N );
+  for ( long i = 0; i < N; ++i )
+    {
+      P[ i ] = Integer( rand() % 100000 + 1 );
+      Q[ i ] = Integer( rand() % 100000 + 1 );
+    }
+  std::vector<Fraction> F( N ), L( N ), R( N );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic,1)
+#endif
+  for ( long i = 0; i < N; ++i )
+    {
+      F[ i ] = SB::fraction( P[ i ], Q[ i ] );
+      L[ i ] = F[ i ].left();
+      R[ i ] = F[ i ].right();
+    }
+  IntegerComputer<Integer> ic;
+  for ( long i = 0; i < N; ++i )
+    {
+      const Integer g = ic.gcd( P[ i ], Q[ i ] );
+      ++nb; nbok += F[ i ].equals( P[ i ] / g, Q[ i ] / g ) ? 1 : 0;
+      ++nb; nbok += ( F[ i ] == SB::fraction( P[ i ], Q[ i ] ) ) ? 1 : 0;
+      ++nb; nbok += ( L[ i ] == F[ i ].left() ) && ( R[ i ] == F[ i ].right() ) ? 1 : 0;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ")"
+               << " fractions computed concurrently." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 int main( int , char** )
 {
   typedef LightSternBrocot<DGtal::int64_t,DGtal::int32_t> SB;
@@ -770,7 +816,8 @@ int main( int , char** )
   bool res = testLightSternBrocot()
     && testPattern<SB>()
     && testSubStandardDSLQ0<Fraction>()
-    && testAncestors<SB>();
+    && testAncestors<SB>()
+    && testConcurrentFractions<SB>();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
 
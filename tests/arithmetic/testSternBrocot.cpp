@@ -30,6 +30,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <cstdlib>
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/arithmetic/CPositiveIrreducibleFraction.h"
@@ -861,6 +862,51 @@ testSimplestFractionInBetween()
 
 
 
+/**
+   Computes fractions and their descendants concurrently (with
+   OpenMP), then checks that they are the nodes computed sequentially.
+*/
+template <typename SB>
+bool
+testConcurrentFractions()
+{
+  typedef typename SB::Integer Integer;
+  typedef typename SB::Fraction Fraction;
+  const long N = 5000;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: concurrent fractions." );
+  srand( 7 );
+  std::vector<Integer> P( N ), Q( N );
+  for ( long i = 0; i < N; ++i )
+    {
+      P[ i ] = Integer( rand() % 100000 + 1 );
+      Q[ i ] = Integer( rand() % 100000 + 1 );
+    }
+  std::vector<Fraction> F( N ), L( N ), R( N );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic,1)
+#endif
+  for ( long i = 0; i < N; ++i )
+    {
+      F[ i ] = SB::fraction( P[ i ], Q[ i ] );
+      L[ i ] = F[ i ].left();
+      R[ i ] = F[ i ].right();
+    }
+  IntegerComputer<Integer> ic;
+  for ( long i = 0; i < N; ++i )
+    {
+      const Integer g = ic.gcd( P[ i ], Q[ i ] );
+      ++nb; nbok += F[ i ].equals( P[ i ] / g, Q[ i ] / g ) ? 1 : 0;
+      ++nb; nbok += ( F[ i ] == SB::fraction( P[ i ], Q[ i ] ) ) ? 1 : 0;
+      ++nb; nbok += ( L[ i ] == F[ i ].left() ) && ( R[ i ] == F[ i ].right() ) ? 1 : 0;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ")"
+               << " fractions computed concurrently." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -879,7 +925,8 @@ int main( int , char** )
     && testSubStandardDSLQ0<Fraction>()
     && testContinuedFractions<SB>()
     && testAncestors<SB>()
-    && testSimplestFractionInBetween<SB>();
+    && testSimplestFractionInBetween<SB>()
+    && testConcurrentFractions<SB>();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
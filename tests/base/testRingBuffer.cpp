@@ -0,0 +1,108 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testRingBuffer.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class RingBuffer.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <deque>
+#include <queue>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/RingBuffer.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class RingBuffer.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "RingBuffer behaves as a queue", "[ringbuffer]" )
+{
+  std::queue< int, RingBuffer< int > > q;
+  std::queue< int, std::deque< int > > ref;
+  REQUIRE( q.empty() );
+
+  SECTION( "Interleaved pushes and pops, with growth in the middle of the array" )
+    {
+      int n = 0;
+      std::size_t nbok = 0, nb = 0;
+      for ( int round = 0; round < 50; ++round )
+        {
+          for ( int i = 0; i < round % 7 + 3; ++i, ++n ) { q.push( n ); ref.push( n ); }
+          for ( int i = 0; i < round % 5 + 1 && ! ref.empty(); ++i )
+            {
+              ++nb; nbok += ( q.front() == ref.front() && q.back() == ref.back() ) ? 1 : 0;
+              q.pop(); ref.pop();
+            }
+          ++nb; nbok += ( q.size() == ref.size() ) ? 1 : 0;
+        }
+      REQUIRE( nbok == nb );
+      while ( ! ref.empty() )
+        {
+          REQUIRE( q.front() == ref.front() );
+          q.pop(); ref.pop();
+        }
+      REQUIRE( q.empty() );
+    }
+}
+
+TEST_CASE( "RingBuffer keeps its capacity", "[ringbuffer]" )
+{
+  RingBuffer< int > buffer( 20 );
+  REQUIRE( buffer.capacity() == 32 );
+  REQUIRE( buffer.isValid() );
+  for ( int i = 0; i < 1000; ++i )
+    {
+      buffer.push_back( i );
+      buffer.push_back( i + 1 );
+      REQUIRE( buffer[ 0 ] == buffer.front() );
+      buffer.pop_front();
+    }
+  REQUIRE( buffer.size() == 1000 );
+  REQUIRE( buffer.front() == 500 );
+  REQUIRE( buffer.back() == 1000 );
+  const std::size_t capacity = buffer.capacity();
+  buffer.clear();
+  REQUIRE( buffer.empty() );
+  REQUIRE( buffer.capacity() == capacity );
+  for ( int i = 0; i < 3000; ++i )
+    {
+      buffer.push_back( i );
+      buffer.pop_front();
+    }
+  REQUIRE( buffer.capacity() == capacity );
+  RingBuffer< int > other;
+  other.push_back( 7 );
+  other.swap( buffer );
+  REQUIRE( buffer.size() == 1 );
+  REQUIRE( buffer.front() == 7 );
+  REQUIRE( other.capacity() == capacity );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
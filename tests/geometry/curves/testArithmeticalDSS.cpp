@@ -29,6 +29,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
+#include <utility>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/base/CConstBidirectionalRange.h"
@@ -876,6 +878,61 @@ bool comparisonSubsegment(typename DSL::Coordinate a, typename DSL::Coordinate b
   return (nb == nbok); 
 }
 
+/**
+ * Compares the batch construction of subsegments 
+ * (ArithmeticalDSSFactory::createSubsegments) to 
+ * the construction of each subsegment with smartCH
+ * for various intercepts and pairs of extremities
+ * @param a numerator of the slope
+ * @param b denominator of the slope
+ * @return 'true' if the two constructions return the same results, 
+ * 'false' otherwise
+ * @tparam DSL an arithmetical DSL (either naive or standard)
+ */
+template <typename DSL>
+bool comparisonSubsegments(typename DSL::Coordinate a, typename DSL::Coordinate b)
+{
+  typedef typename DSL::Point Point; 
+  typedef typename DSL::Coordinate Coordinate; 
+  typedef typename DSL::Integer Integer; 
+  typedef ArithmeticalDSS<Coordinate,Integer,DSL::foregroundAdjacency> DSS; 
+  typedef ArithmeticalDSSFactory<Coordinate,Integer,DSL::foregroundAdjacency> Factory; 
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Batch subsegment comparison ..." );
+
+  DSL aDSL(a, b, 0); 
+  for (Integer mu = 0; ( (mu-1 >= -aDSL.omega())&&(nbok == nb) ); --mu)
+    {
+      DSL dsl(a, b, mu); 
+      std::vector< std::pair<Point,Point> > extremities; 
+      for (typename DSL::Position l = 0; l <= 2*aDSL.patternLength(); ++l)
+	for (typename DSL::Position k = 0; k <= l; ++k)
+	  extremities.push_back( std::make_pair( dsl.getPoint(k), dsl.getPoint(l) ) ); 
+
+      std::vector<DSS> subsegments; 
+      Factory::createSubsegments( dsl, extremities, subsegments ); 
+
+      nb++; 
+      if (subsegments.size() == extremities.size())
+	nbok++; 
+      for (unsigned int i = 0; ( (i < extremities.size())&&(nbok == nb) ); ++i)
+	{
+	  DSS dss( dsl, extremities[i].first, extremities[i].second ); //smartCH (log)
+	  if (subsegments[i] == dss)
+	    nbok++;
+	  nb++; 
+	}
+    }
+
+  trace.info() << "(" << nbok << "/" << nb << ")" << std::endl; 
+  trace.endBlock(); 
+
+  return (nb == nbok); 
+}
+
 //---------------------------------------------------------------------------
 bool unionTest()
 {
@@ -1491,6 +1548,19 @@ int main( int argc, char** argv )
 #endif
       ;
   }
+
+  {   //batch of subsegments 
+  res = res 
+    && comparisonSubsegments<NaiveDSL<DGtal::int32_t> >(5,8)
+    && comparisonSubsegments<NaiveDSL<DGtal::int32_t> >(12,29)
+    && comparisonSubsegments<NaiveDSL<DGtal::int32_t> >(-8,5)
+    && comparisonSubsegments<NaiveDSL<DGtal::int32_t> >(5,-8)
+    && comparisonSubsegments<NaiveDSL<DGtal::int32_t> >(1,0)
+    && comparisonSubsegments<StandardDSL<DGtal::int32_t> >(5,8)
+    && comparisonSubsegments<StandardDSL<DGtal::int32_t> >(-8,-5)
+    && comparisonSubsegments<StandardDSL<DGtal::int32_t> >(0,1)
+      ;
+  }
   
   { // createDSS
     res = res && createDSSTest();
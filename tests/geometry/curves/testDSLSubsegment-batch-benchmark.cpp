@@ -0,0 +1,186 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDSLSubsegment-batch-benchmark.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Benchmark of the batch subsegment computations
+ * (DSLSubsegment::subsegments and
+ * ArithmeticalDSSFactory::createSubsegments) against the
+ * computation of each subsegment one by one.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/geometry/curves/DSLSubsegment.h"
+#include "DGtal/geometry/curves/ArithmeticalDSL.h"
+#include "DGtal/geometry/curves/ArithmeticalDSS.h"
+#include "DGtal/geometry/curves/ArithmeticalDSSFactory.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking batch subsegment computations.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Computes @a nbqueries random subsegments of length at most @a modl
+ * of @a nbtries random DSLs of slope a/b, 0 < a <= b <= modb, one by
+ * one and in batch, and writes the timings of each DSL.
+ * @return 'true' if the batch results are the ones computed one by one.
+ */
+template <typename Integer>
+bool benchmarkDSLSubsegment( unsigned int nbtries, Integer modb,
+                             unsigned int nbqueries, Integer modl )
+{
+  typedef DSLSubsegment<Integer,Integer> DSLSubseg;
+  typedef typename DSLSubseg::Point Point;
+  IntegerComputer<Integer> ic;
+
+  bool ok = true;
+  double tQueries = 0.0, tBatch = 0.0;
+  std::cout << "# DSLSubsegment (farey): a b mu nbqueries t_queries(ms) t_batch(ms)" << std::endl;
+  for ( unsigned int i = 0; i < nbtries; ++i )
+    {
+      Integer b( rand() % modb + 1 );
+      Integer a( rand() % b + 1 );
+      while ( ic.gcd( a, b ) != 1 )
+        a = rand() % b + 1;
+      Integer mu( rand() % ( 2 * b ) );
+
+      std::vector< std::pair<Point,Point> > extremities;
+      for ( unsigned int k = 0; k < nbqueries; ++k )
+        {
+          Integer x1( rand() % ( 4 * b ) );
+          Integer x2( x1 + 1 + rand() % modl );
+          extremities.push_back( std::make_pair( Point( x1, ic.floorDiv( a * x1 + mu, b ) ),
+                                                 Point( x2, ic.floorDiv( a * x2 + mu, b ) ) ) );
+        }
+
+      Clock c;
+      c.startClock();
+      std::vector<DSLSubseg> expected;
+      for ( unsigned int k = 0; k < extremities.size(); ++k )
+        expected.push_back( DSLSubseg( a, b, mu, extremities[ k ].first,
+                                       extremities[ k ].second, "farey" ) );
+      double t1 = c.stopClock();
+      c.startClock();
+      std::vector<DSLSubseg> batch;
+      DSLSubseg::subsegments( a, b, mu, extremities, batch, "farey" );
+      double t2 = c.stopClock();
+      tQueries += t1;
+      tBatch   += t2;
+      std::cout << a << " " << b << " " << mu << " " << nbqueries
+                << " " << t1 << " " << t2 << std::endl;
+
+      for ( unsigned int k = 0; k < extremities.size(); ++k )
+        ok = ok && ( batch[ k ].getA() == expected[ k ].getA() )
+          && ( batch[ k ].getB() == expected[ k ].getB() )
+          && ( batch[ k ].getMu() == expected[ k ].getMu() );
+    }
+  std::cout << "# total " << tQueries << " " << tBatch << std::endl;
+  return ok;
+}
+
+/**
+ * Computes @a nbqueries random subsegments of length at most @a modl
+ * of @a nbtries random naive DSLs of slope a/b, 0 < a <= b <= modb,
+ * one by one and in batch, and writes the timings of each DSL.
+ * @return 'true' if the batch results are the ones computed one by one.
+ */
+template <typename Integer>
+bool benchmarkArithmeticalDSSFactory( unsigned int nbtries, Integer modb,
+                                      unsigned int nbqueries, Integer modl )
+{
+  typedef ArithmeticalDSL<Integer,Integer,8> DSL;
+  typedef ArithmeticalDSS<Integer,Integer,8> DSS;
+  typedef ArithmeticalDSSFactory<Integer,Integer,8> Factory;
+  typedef typename DSL::Point Point;
+  IntegerComputer<Integer> ic;
+
+  bool ok = true;
+  double tQueries = 0.0, tBatch = 0.0;
+  std::cout << "# ArithmeticalDSSFactory: a b mu nbqueries t_queries(ms) t_batch(ms)" << std::endl;
+  for ( unsigned int i = 0; i < nbtries; ++i )
+    {
+      Integer b( rand() % modb + 1 );
+      Integer a( rand() % b + 1 );
+      while ( ic.gcd( a, b ) != 1 )
+        a = rand() % b + 1;
+      DSL dsl( a, b, -Integer( rand() % b ) );
+
+      std::vector< std::pair<Point,Point> > extremities;
+      for ( unsigned int k = 0; k < nbqueries; ++k )
+        {
+          Integer x1( rand() % ( 4 * b ) );
+          Integer x2( x1 + 1 + rand() % modl );
+          extremities.push_back( std::make_pair( dsl.getPoint( x1 ), dsl.getPoint( x2 ) ) );
+        }
+
+      Clock c;
+      c.startClock();
+      std::vector<DSS> expected;
+      for ( unsigned int k = 0; k < extremities.size(); ++k )
+        expected.push_back( Factory::createSubsegment( dsl, extremities[ k ].first,
+                                                       extremities[ k ].second ) );
+      double t1 = c.stopClock();
+      c.startClock();
+      std::vector<DSS> batch;
+      Factory::createSubsegments( dsl, extremities, batch );
+      double t2 = c.stopClock();
+      tQueries += t1;
+      tBatch   += t2;
+      std::cout << a << " " << b << " " << dsl.mu() << " " << nbqueries
+                << " " << t1 << " " << t2 << std::endl;
+
+      ok = ok && ( batch == expected );
+    }
+  std::cout << "# total " << tQueries << " " << tBatch << std::endl;
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  typedef DGtal::int64_t Integer;
+  unsigned int nbtries   = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 20;
+  Integer modb           = ( argc > 2 ) ? atoll( argv[ 2 ] ) : 1000000;
+  unsigned int nbqueries = ( argc > 3 ) ? atoi( argv[ 3 ] ) : 100000;
+  Integer modl           = ( argc > 4 ) ? atoll( argv[ 4 ] ) : 1000;
+  srand( 0 );
+  bool res = benchmarkDSLSubsegment<Integer>( nbtries, modb, nbqueries, modl )
+    && benchmarkArithmeticalDSSFactory<Integer>( nbtries, modb, nbqueries, modl );
+  return res ? 0 : 1;
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <map>
+#include <vector>
+#include <utility>
 #include "DGtal/geometry/curves/DSLSubsegment.h"
 #include "DGtal/arithmetic/StandardDSLQ0.h"
 #include "DGtal/kernel/CPointPredicate.h"
@@ -160,6 +162,53 @@ bool testDSLSubsegment(Integer modb)
   trace.endBlock();
   trace.info() << std::endl;
   
+  int error4 = 0;
+  trace.beginBlock("Compare DSLSubsegment::subsegments with DSLSubsegment");
+  {
+    std::vector< std::pair<Point,Point> > extremities;
+    for(unsigned int i = 0; i<l; i++)
+      for(unsigned int j = i+1; j<l; j++)
+	{
+	  Integer x1 = xf+i;
+	  Integer x2 = xf+j;
+	  extremities.push_back(std::make_pair(Point(x1,ic.floorDiv(a*x1+mu,b)),
+					       Point(x2,ic.floorDiv(a*x2+mu,b))));
+	}
+
+    Clock c;
+    c.startClock();
+    std::vector<DSLSubseg> expected;
+    for(unsigned int k = 0; k<extremities.size(); k++)
+      expected.push_back(DSLSubseg(a,b,mu,extremities[k].first,extremities[k].second,"farey"));
+    double tQueries = c.stopClock();
+    
+    c.startClock();
+    std::vector<DSLSubseg> batchF;
+    DSLSubseg::subsegments(a,b,mu,extremities,batchF,"farey");
+    double tBatch = c.stopClock();
+    
+    std::vector<DSLSubseg> batchCH;
+    DSLSubseg::subsegments(a,b,mu,extremities,batchCH,"localCH");
+    
+    trace.info() << extremities.size() << " subsegments: " << tQueries << " ms one by one, "
+		 << tBatch << " ms in batch." << std::endl;
+    
+    if(batchF.size() != extremities.size() || batchCH.size() != extremities.size())
+      error4 ++;
+    else
+      for(unsigned int k = 0; k<extremities.size(); k++)
+	{
+	  // If results are different, count an error
+	  if(batchF[k].getA() != expected[k].getA() || batchF[k].getB() != expected[k].getB() || batchF[k].getMu() != expected[k].getMu())
+	    error4 ++;
+	  if(batchCH[k].getA() != expected[k].getA() || batchCH[k].getB() != expected[k].getB() || batchCH[k].getMu() != expected[k].getMu())
+	    error4 ++;
+	}
+  }
+  trace.info() << error4 << " errors." << std::endl;
+  trace.endBlock();
+  trace.info() << std::endl;
+  
   int error3 = 0;
   trace.beginBlock("Compare DSLSubsegment/FareyFan with ReversedSmartDSS for 4-connected DSL");
   for(unsigned int i = 0; i<l; i++)
@@ -197,7 +246,7 @@ bool testDSLSubsegment(Integer modb)
   trace.endBlock();
   trace.info() << std::endl;
   
-  return (error1==0 && error2==0 && error3==0);
+  return (error1==0 && error2==0 && error3==0 && error4==0);
 
 }
 
@@ -939,6 +939,101 @@ bool SaturatedSegmentationTest()
 //////////////// MAIN ///////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////
 
+/**
+ * Compares the segments of a saturated segmentation computed by chunks
+ * (computeSegments) with the ones visited by its iterators.
+ */
+template <typename Segmentation>
+bool sameSegments(const Segmentation& s, std::size_t chunkSize)
+{
+  typedef typename Segmentation::SegmentComputer SegmentComputer; 
+  std::vector<SegmentComputer> segments; 
+  s.computeSegments( segments, chunkSize ); 
+
+  unsigned int n = 0; 
+  for (typename Segmentation::SegmentComputerIterator i = s.begin(), end = s.end();
+       i != end; ++i, ++n) {
+    if ( (n >= segments.size())
+         || (i->begin() != segments[n].begin())
+         || (i->end() != segments[n].end()) )
+      return false; 
+  }
+  return (n == segments.size()); 
+}
+
+/**
+ * Saturated segmentation computed by chunks
+ */
+bool parallelSaturatedSegmentationTest()
+{
+  typedef int Coordinate;
+  typedef FreemanChain<Coordinate> FC; 
+  typedef PointVector<2,Coordinate> Point; 
+
+  std::string filename = testPath + "samples/BigBall2.fc";
+  std::fstream fst;
+  fst.open (filename.c_str(), std::ios::in);
+  FC fc(fst);
+  vector<Point> vPts; 
+  vPts.assign(fc.begin(),fc.end()); 
+  vPts.pop_back(); //closed curve
+
+  typedef vector<Point>::const_iterator ConstIterator; 
+  typedef Circulator<ConstIterator> ConstCirculator; 
+  typedef ArithmeticalDSSComputer<ConstIterator,Coordinate,4> RecognitionAlgorithm;
+  typedef SaturatedSegmentation<RecognitionAlgorithm> Segmentation;
+  typedef ArithmeticalDSSComputer<ConstCirculator,Coordinate,4> CirculatorRecognitionAlgorithm;
+  typedef SaturatedSegmentation<CirculatorRecognitionAlgorithm> CirculatorSegmentation;
+
+  trace.beginBlock("saturated Segmentation computed by chunks");
+  unsigned int nbok = 0, nb = 0; 
+  const std::string modes[] = { "First", "MostCentered", "Last", 
+                                "First++", "MostCentered++", "Last++" }; 
+  const std::size_t chunkSizes[] = { 1, 97, 4096, 1000000 }; 
+  ConstCirculator c(vPts.begin(), vPts.begin(), vPts.end() ); 
+  ConstIterator itb = vPts.begin() + 1000; 
+  ConstIterator ite = vPts.begin() + 1600;
+  //subranges (every mode and chunk size)
+  for (unsigned int m = 0; m < 6; ++m) {
+    for (unsigned int k = 0; k < 4; ++k) {
+      Segmentation s(vPts.begin(), vPts.end(), RecognitionAlgorithm());
+      s.setMode(modes[m]); 
+      s.setSubRange(itb, ite); 
+      nbok += sameSegments(s, chunkSizes[k]) ? 1 : 0; 
+      CirculatorSegmentation cs(c, c, CirculatorRecognitionAlgorithm());
+      cs.setMode(modes[m]); 
+      cs.setSubRange(c + 199700, c + 300); 
+      nbok += sameSegments(cs, chunkSizes[k]) ? 1 : 0; 
+      nb += 2; 
+    }
+  }
+
+  //whole ranges of a shorter curve: the mode only changes 
+  //the processing of the subrange ends, hence one mode is enough
+  std::string wholeFilename = testPath + "samples/Ball2.fc";
+  std::fstream wholeFst;
+  wholeFst.open (wholeFilename.c_str(), std::ios::in);
+  FC wholeFc(wholeFst);
+  vector<Point> wPts; 
+  wPts.assign(wholeFc.begin(),wholeFc.end()); 
+  wPts.pop_back(); //closed curve
+  ConstCirculator wc(wPts.begin(), wPts.begin(), wPts.end() ); 
+  for (unsigned int k = 1; k < 4; ++k) {
+    Segmentation ws(wPts.begin(), wPts.end(), RecognitionAlgorithm());
+    ws.setMode(modes[0]); 
+    nbok += sameSegments(ws, chunkSizes[k]) ? 1 : 0; 
+    CirculatorSegmentation wcs(wc, wc, CirculatorRecognitionAlgorithm());
+    wcs.setMode(modes[0]); 
+    nbok += sameSegments(wcs, chunkSizes[k]) ? 1 : 0; 
+    nb += 2; 
+  }
+  trace.info() << "(" << nbok << "/" << nb << ")" << endl;
+
+  trace.endBlock();
+
+  return (nbok == nb);
+}
+
 int main(int argc, char **argv)
 {
   
@@ -951,6 +1046,7 @@ int main(int argc, char **argv)
   bool res = greedySegmentationVisualTest()
 && SaturatedSegmentationVisualTest()
 && SaturatedSegmentationTest()
+&& parallelSaturatedSegmentationTest()
 ;
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
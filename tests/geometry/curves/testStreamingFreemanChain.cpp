@@ -0,0 +1,195 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testStreamingFreemanChain.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class StreamingFreemanChain.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <algorithm>
+#include "DGtalCatch.h"
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/StreamingFreemanChain.h"
+#include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/geometry/curves/SaturatedSegmentation.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "ConfigTest.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class StreamingFreemanChain.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef FreemanChain<int> Chain;
+typedef StreamingFreemanChain<int> Stream;
+typedef Chain::Point Point;
+
+/// The first and last points of each segment of a segmentation.
+template <typename TSegmentation>
+std::vector< std::pair<Point,Point> >
+segmentEnds( const TSegmentation & segmentation )
+{
+  std::vector< std::pair<Point,Point> > ends;
+  for ( typename TSegmentation::SegmentComputerIterator
+          it = segmentation.begin(), itEnd = segmentation.end();
+        it != itEnd; ++it )
+    ends.push_back( std::make_pair( it->front(), it->back() ) );
+  return ends;
+}
+
+/// The points of a curve given by two iterators.
+template <typename TIterator>
+std::vector<Point> points( TIterator it, TIterator itEnd )
+{
+  std::vector<Point> pts;
+  for ( ; it != itEnd; ++it ) pts.push_back( *it );
+  return pts;
+}
+
+TEST_CASE( "Testing StreamingFreemanChain" )
+{
+  const std::string filename = testPath + "samples/contourS.fc";
+  std::ifstream inChain( filename.c_str() );
+  Chain fc( inChain );
+
+  SECTION( "Points of a stream with a small window" )
+    {
+      std::ifstream in( filename.c_str() );
+      Stream stream( in, 4 );
+      REQUIRE( stream.firstPoint() == *fc.begin() );
+      std::vector<Point> pts = points( stream.begin(), stream.end() );
+      REQUIRE( pts == points( fc.begin(), fc.end() ) );
+      REQUIRE( stream.isExhausted() );
+      REQUIRE( stream.nbReadPoints() == fc.size() + 1 );
+      REQUIRE( stream.windowSize() == 4 );
+      REQUIRE( stream.firstAvailableIndex() + 4 == stream.nbReadPoints() );
+      REQUIRE_THROWS_AS( stream.point( 0 ), MemoryException );
+      Stream::ConstIterator last = stream.end(); --last;
+      REQUIRE( *last == pts.back() );
+      REQUIRE( stream.isValid() );
+    }
+
+  SECTION( "Stream from a code generator" )
+    {
+      std::string codes = fc.chain;
+      std::size_t i = 0;
+      Stream::CodeSource source = [ &codes, &i ] ( char & c )
+        {
+          if ( i == codes.size() ) return false;
+          c = codes[ i++ ];
+          return true;
+        };
+      Stream stream( *fc.begin(), source, 16 );
+      REQUIRE( points( stream.begin(), stream.end() )
+               == points( fc.begin(), fc.end() ) );
+      REQUIRE( stream.size() == fc.size() + 1 );
+    }
+
+  SECTION( "Greedy and saturated segmentations of a stream" )
+    {
+      typedef ArithmeticalDSSComputer<Chain::ConstIterator,int,4> Computer;
+      typedef ArithmeticalDSSComputer<Stream::ConstIterator,int,4> StreamComputer;
+      const std::size_t window = 128;
+
+      GreedySegmentation<Computer> greedy( fc.begin(), fc.end(), Computer() );
+      std::ifstream in1( filename.c_str() );
+      Stream stream1( in1, window );
+      GreedySegmentation<StreamComputer>
+        streamGreedy( stream1.begin(), stream1.end(), StreamComputer() );
+      std::vector< std::pair<Point,Point> > expected = segmentEnds( greedy );
+      REQUIRE( expected.size() > 1 );
+      REQUIRE( segmentEnds( streamGreedy ) == expected );
+
+      const char* modes[] = { "First", "MostCentered", "Last++" };
+      for ( unsigned int m = 0; m < 3; ++m )
+        {
+          SaturatedSegmentation<Computer> saturated( fc.begin(), fc.end(), Computer() );
+          saturated.setMode( modes[ m ] );
+          std::ifstream in2( filename.c_str() );
+          Stream stream2( in2, window );
+          SaturatedSegmentation<StreamComputer>
+            streamSaturated( stream2.begin(), stream2.end(), StreamComputer() );
+          streamSaturated.setMode( modes[ m ] );
+          expected = segmentEnds( saturated );
+          REQUIRE( expected.size() > 1 );
+          REQUIRE( segmentEnds( streamSaturated ) == expected );
+          REQUIRE( stream2.firstAvailableIndex() > 0 );
+        }
+
+      // the window is too small for the maximal segments.
+      std::ifstream in3( filename.c_str() );
+      Stream stream3( in3, 2 );
+      SaturatedSegmentation<StreamComputer>
+        tooSmall( stream3.begin(), stream3.end(), StreamComputer() );
+      REQUIRE_THROWS_AS( segmentEnds( tooSmall ), MemoryException );
+    }
+}
+
+TEST_CASE( "Testing Boundary2DFreemanCodes" )
+{
+  typedef Z2i::KSpace KSpace;
+  typedef Z2i::DigitalSet DigitalSet;
+  Z2i::Domain domain( Z2i::Point( -12, -12 ), Z2i::Point( 12, 12 ) );
+  DigitalSet shape( domain );
+  for ( Z2i::Domain::ConstIterator it = domain.begin(), itE = domain.end();
+        it != itE; ++it )
+    {
+      Z2i::Point p = *it;
+      if ( ( p.norm() <= 8.5 && ! ( p[ 0 ] > 2 && std::abs( p[ 1 ] ) < 2 ) )
+           || ( p[ 0 ] >= 6 && p[ 0 ] <= 11 && p[ 1 ] >= 5 && p[ 1 ] <= 7 ) )
+        shape.insertNew( p );
+    }
+  KSpace K;
+  REQUIRE( K.init( domain.lowerBound() - Z2i::Point::diagonal( 1 ),
+                   domain.upperBound() + Z2i::Point::diagonal( 1 ), true ) );
+  SurfelAdjacency<2> sAdj( true );
+  KSpace::SCell bel = Surfaces<KSpace>::findABel( K, shape, 10000 );
+
+  std::vector<Z2i::Point> expected;
+  Surfaces<KSpace>::track2DBoundaryPoints( expected, K, sAdj, shape, bel );
+  // track2DBoundaryPoints ends with the start surfel.
+  std::rotate( expected.begin(), expected.end() - 1, expected.end() );
+
+  typedef Boundary2DFreemanCodes<KSpace,DigitalSet> Codes;
+  Codes codes( K, sAdj, shape, bel );
+  Stream stream( codes.firstPoint(), codes, 8 );
+  std::vector<Point> pts = points( stream.begin(), stream.end() );
+  REQUIRE( pts.size() == expected.size() + 1 );
+  REQUIRE( pts.back() == pts.front() );
+  pts.pop_back();
+  REQUIRE( pts == expected );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
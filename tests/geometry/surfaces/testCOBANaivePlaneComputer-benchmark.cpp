@@ -35,6 +35,7 @@
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/geometry/surfaces/COBANaivePlaneComputer.h"
+#include "DGtal/arithmetic/CheckedInt128.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -170,6 +171,22 @@ int main( int argc, char** argv )
             << " " << stats.mean()
             << " " << stats.variance()
             << std::endl;
+#ifdef DGTAL_HAS_INT128
+  Statistic<double> stats128;
+  trace.beginBlock ( "Testing class COBANaivePlaneComputer with CheckedInt128" );
+  bool res128 = checkPlanes<COBANaivePlaneComputer<Z3, DGtal::CheckedInt128> >( nbtries, diameter, nbpoints, stats128 );
+  trace.emphase() << ( res128 ? "Passed." : "Error." ) << endl;
+  t = trace.endBlock();
+  stats128.terminate();
+  std::cout << "CheckedInt128" << " " << stats128.samples()
+            << " " << nbpoints
+            << " " << diameter 
+            << " " << ( (double) t / (double) stats128.samples() )
+            << " " << stats128.mean()
+            << " " << stats128.variance()
+            << std::endl;
+  res = res && res128;
+#endif
   return res ? 0 : 1;
 }
 //                                                                           //
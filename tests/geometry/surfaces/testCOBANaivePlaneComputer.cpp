@@ -36,6 +36,7 @@
 #include "DGtal/geometry/surfaces/CAdditivePrimitiveComputer.h"
 #include "DGtal/geometry/surfaces/COBANaivePlaneComputer.h"
 #include "DGtal/geometry/surfaces/COBAGenericNaivePlaneComputer.h"
+#include "DGtal/arithmetic/CheckedInt128.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -485,13 +486,17 @@ int main( int /*argc*/, char** /*argv*/ )
 {
   using namespace Z3i;
 
-  // Max diameter is ~20 for int32_t, ~500 for int64_t, any with BigInteger.
+  // Max diameter is ~20 for int32_t, ~500 for int64_t, ~10^6 for
+  // CheckedInt128 without GMP, any with BigInteger.
   trace.beginBlock ( "Testing class COBANaivePlaneComputer" );
   bool res = true 
     && testCOBANaivePlaneComputer()
     && checkManyPlanes<COBANaivePlaneComputer<Z3, DGtal::int32_t> >( 20, 100, 200 )
     && checkManyPlanes<COBANaivePlaneComputer<Z3, DGtal::int64_t> >( 500, 100, 200 )
     && checkManyPlanes<COBANaivePlaneComputer<Z3, DGtal::BigInteger> >( 10000, 10, 200 )
+#ifdef DGTAL_HAS_INT128
+    && checkManyPlanes<COBANaivePlaneComputer<Z3, DGtal::CheckedInt128> >( 10000, 10, 200 )
+#endif
     && checkExtendWithManyPoints<COBAGenericNaivePlaneComputer<Z3, DGtal::int64_t> >( 100, 100, 200 );
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
@@ -36,6 +36,7 @@
 #include "DGtal/geometry/surfaces/CAdditivePrimitiveComputer.h"
 #include "DGtal/geometry/surfaces/ChordNaivePlaneComputer.h"
 #include "DGtal/geometry/surfaces/ChordGenericNaivePlaneComputer.h"
+#include "DGtal/arithmetic/CheckedInt128.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -773,6 +774,8 @@ checkExtendWithManyPoints( unsigned int diameter,
 int main( int /*argc*/, char**/* argv */)
 {
   using namespace Z3i;
+  // int64_t points, for diameters beyond the capacity of int64_t computations.
+  typedef SpaceND<3, DGtal::int64_t> Space64;
 
   trace.beginBlock ( "Testing class ChordNaivePlaneComputer" );
   bool res = true
@@ -783,6 +786,9 @@ int main( int /*argc*/, char**/* argv */)
     && checkManyPlanes<ChordNaivePlaneComputer<Z3i::Space, Z3i::Point, DGtal::int32_t> >( 100, 100, 200 )
     && checkManyPlanes<ChordNaivePlaneComputer<Z3i::Space, Z3i::Point, DGtal::int64_t> >( 2000, 100, 200 )
     && checkWidths<DGtal::int64_t, ChordNaivePlaneComputer<Z3i::Space, Z3i::Point, DGtal::int64_t> >( 100, 1000000, 1000 )
+#ifdef DGTAL_HAS_INT128
+    && checkManyPlanes<ChordNaivePlaneComputer<Space64, Space64::Point, DGtal::CheckedInt128> >( 2000000000, 10, 200 )
+#endif
     && checkExtendWithManyPoints<ChordGenericNaivePlaneComputer<Z3i::Space, Z3i::Point, DGtal::int64_t> >( 100, 100, 200 );
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
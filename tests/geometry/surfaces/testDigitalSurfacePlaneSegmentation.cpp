@@ -0,0 +1,188 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDigitalSurfacePlaneSegmentation.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class DigitalSurfacePlaneSegmentation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <map>
+#include <vector>
+#include "DGtalCatch.h"
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/IndexedDigitalSurface.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+#include "DGtal/geometry/surfaces/COBAGenericNaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/ChordGenericNaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/DigitalSurfacePlaneSegmentation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DigitalSurfacePlaneSegmentation.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef DigitalSetBoundary<KSpace,DigitalSet>        Container;
+typedef DigitalSurface<Container>                    Surface;
+typedef COBAGenericNaivePlaneComputer<Space, DGtal::int64_t>  COBAComputer;
+typedef ChordGenericNaivePlaneComputer<Space, Point, DGtal::int64_t> ChordComputer;
+
+/**
+ * Greedy segmentation as in the example greedy-plane-segmentation:
+ * seeds are taken in increasing order of surfels, planes are grown
+ * with a BreadthFirstVisitor.
+ *
+ * @return the plane index of each surfel.
+ */
+template <typename PlaneComputer>
+std::map<SCell, unsigned int>
+greedySegmentation( const KSpace & K, const Surface & surface,
+                    const PlaneComputer & prototype )
+{
+  typedef BreadthFirstVisitor<Surface> Visitor;
+  std::map<SCell, unsigned int> planeIndex;
+  std::set<SCell> surfels( surface.begin(), surface.end() );
+  unsigned int nbPlanes = 0;
+  for ( std::set<SCell>::const_iterator it = surfels.begin(), itE = surfels.end();
+        it != itE; ++it )
+    {
+      if ( planeIndex.count( *it ) ) continue;
+      PlaneComputer plane( prototype );
+      plane.clear();
+      Visitor visitor( surface, *it );
+      while ( ! visitor.finished() )
+        {
+          SCell v = visitor.current().first;
+          Point p = K.sCoords( K.sDirectIncident( v, K.sOrthDir( v ) ) );
+          if ( ! planeIndex.count( v ) && plane.extend( p ) )
+            {
+              planeIndex[ v ] = nbPlanes;
+              visitor.expand();
+            }
+          else
+            visitor.ignore();
+        }
+      ++nbPlanes;
+    }
+  return planeIndex;
+}
+
+/// Checks a segmentation against the greedy one and against its planes.
+template <typename Segmentation>
+bool checkSegmentation( const Segmentation & segmentation,
+                        const std::map<SCell, unsigned int> & expected )
+{
+  typedef typename Segmentation::Graph Graph;
+  const Graph & graph = segmentation.graph();
+  if ( graph.size() != expected.size() || ! segmentation.isValid() ) return false;
+  std::vector<unsigned int> sizes( segmentation.nbPlanes(), 0 );
+  for ( typename Graph::Vertex v = 0; v < graph.size(); ++v )
+    {
+      const unsigned int idx = segmentation.planeIndex( v );
+      if ( idx != expected.find( graph.surfel( v ) )->second ) return false;
+      if ( idx != segmentation.planeIndex( graph.surfel( v ) ) ) return false;
+      const typename Segmentation::Plane & plane = segmentation.planes()[ idx ];
+      const double x = plane.normal.dot( segmentation.point( v ) );
+      if ( x < plane.min - 1e-9 || x > plane.max + 1e-9 ) return false;
+      ++sizes[ idx ];
+    }
+  for ( unsigned int i = 0; i < sizes.size(); ++i )
+    if ( sizes[ i ] != segmentation.planes()[ i ].size
+         || segmentation.planeIndex( segmentation.planes()[ i ].seed ) != i )
+      return false;
+  return true;
+}
+
+TEST_CASE( "Testing DigitalSurfacePlaneSegmentation" )
+{
+  Domain domain( Point( -12, -12, -12 ), Point( 12, 12, 12 ) );
+  DigitalSet shape( domain );
+  for ( Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+    {
+      Point p = *it;
+      if ( p.norm() <= 8.5
+           || ( p[ 0 ] >= 4 && p[ 0 ] <= 10 && p[ 1 ] >= -2 && p[ 1 ] <= 3
+                && p[ 2 ] + p[ 0 ] / 2 >= -1 && p[ 2 ] + p[ 0 ] / 2 <= 6 ) )
+        shape.insertNew( p );
+    }
+  KSpace K;
+  REQUIRE( K.init( domain.lowerBound() - Point::diagonal( 1 ),
+                   domain.upperBound() + Point::diagonal( 1 ), true ) );
+  SurfelAdjacency<3> sAdj( true );
+  Container* container = new Container( K, shape, sAdj );
+  Surface surface( container ); // acquired
+
+  SECTION( "Segmentation with COBA plane computers" )
+    {
+      COBAComputer prototype;
+      prototype.init( 100, 1, 1 );
+      std::map<SCell, unsigned int> expected
+        = greedySegmentation( K, surface, prototype );
+      REQUIRE( expected.size() == surface.size() );
+      const DigitalSurfacePlaneSegmentation<KSpace, COBAComputer>::Size
+        batches[] = { 0, 1, 5, 1000 };
+      for ( unsigned int i = 0; i < 4; ++i )
+        {
+          DigitalSurfacePlaneSegmentation<KSpace, COBAComputer>
+            segmentation( prototype, batches[ i ] );
+          segmentation.compute( surface );
+          CAPTURE( batches[ i ] );
+          REQUIRE( segmentation.nbPlanes() > 1 );
+          REQUIRE( checkSegmentation( segmentation, expected ) );
+        }
+    }
+
+  SECTION( "Segmentation with Chord plane computers of width 2" )
+    {
+      ChordComputer prototype;
+      prototype.init( 2, 1 );
+      std::map<SCell, unsigned int> expected
+        = greedySegmentation( K, surface, prototype );
+      DigitalSurfacePlaneSegmentation<KSpace, ChordComputer> segmentation( prototype, 7 );
+      segmentation.compute( surface );
+      REQUIRE( checkSegmentation( segmentation, expected ) );
+    }
+
+  SECTION( "Segmentation of an indexed digital surface" )
+    {
+      COBAComputer prototype;
+      prototype.init( 100, 1, 1 );
+      IndexedDigitalSurface<Container> indexed( new Container( K, shape, sAdj ) );
+      DigitalSurfacePlaneSegmentation<KSpace, COBAComputer> segmentation( prototype, 16 );
+      segmentation.compute( indexed );
+      REQUIRE( checkSegmentation( segmentation,
+                                  greedySegmentation( K, surface, prototype ) ) );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,125 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMaximalDigitalPlaneNormalEstimator-benchmark.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Benchmark of MaximalDigitalPlaneNormalEstimator against the
+ * integral invariant normal estimator on a digitized ellipsoid
+ * (timings and mean angle errors).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/helpers/ShortcutsGeometry.h"
+#include "DGtal/geometry/surfaces/COBAGenericNaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/estimation/MaximalDigitalPlaneNormalEstimator.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Shortcuts<Z3i::KSpace>         SH3;
+typedef ShortcutsGeometry<Z3i::KSpace> SHG3;
+typedef COBAGenericNaivePlaneComputer<Z3i::Space, DGtal::int64_t> COBAComputer;
+typedef SH3::DigitalSurface::DigitalSurfaceContainer SurfaceContainer;
+typedef MaximalDigitalPlaneNormalEstimator<SurfaceContainer, COBAComputer> Estimator;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class MaximalDigitalPlaneNormalEstimator.
+///////////////////////////////////////////////////////////////////////////////
+
+/// @return the angle between two unit vectors.
+double angle( const Z3i::RealVector & u, const Z3i::RealVector & v )
+{
+  return std::acos( std::max( -1.0, std::min( 1.0, u.dot( v ) ) ) );
+}
+
+/**
+ * Estimates the normals of a digitized ellipsoid at grid step @a h
+ * with integral invariants and with maximal digital planes of radius
+ * at most @a maxRadius, and writes the timings and mean angle errors.
+ */
+void benchmarkNormals( double h, unsigned int maxRadius )
+{
+  auto params = SH3::defaultParameters() | SHG3::defaultParameters();
+  params( "polynomial", "x^2+2*y^2+3*z^2-100" )( "minAABB", -11. )( "maxAABB", 11. )
+    ( "gridstep", h )( "verbose", 0 );
+  auto implicit_shape  = SH3::makeImplicitShape3D( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto K               = SH3::getKSpace( params );
+  auto surface         = SH3::makeDigitalSurface( digitized_shape, K, params );
+  auto surfels         = SH3::getSurfelRange( surface, params );
+  auto true_normals    = SHG3::getNormalVectors( implicit_shape, K, surfels, params );
+
+  Clock c;
+  c.startClock();
+  auto ii_normals = SHG3::getIINormalVectors( digitized_shape, surfels, params );
+  const double ii_time = c.stopClock();
+
+  c.startClock();
+  COBAComputer prototype;
+  prototype.init( 100, 1, 1 );
+  Estimator estimator( surface );
+  estimator.setParams( prototype, maxRadius );
+  estimator.init( h, surfels.begin(), surfels.end() );
+  SH3::RealVectors mp_normals;
+  estimator.eval( surfels.begin(), surfels.end(), std::back_inserter( mp_normals ) );
+  const double mp_time = c.stopClock();
+
+  double ii_error = 0.0;
+  double mp_error = 0.0;
+  for ( std::size_t i = 0; i < surfels.size(); ++i )
+    {
+      ii_error += angle( ii_normals[ i ], true_normals[ i ] );
+      mp_error += angle( mp_normals[ i ], true_normals[ i ] );
+    }
+  ii_error /= surfels.size();
+  mp_error /= surfels.size();
+
+  std::cout << "# h max_radius nb_surfels t_ii(ms) error_ii t_maximal_planes(ms) error_maximal_planes"
+            << std::endl;
+  std::cout << h << " " << maxRadius << " " << surfels.size() << " "
+            << ii_time << " " << ii_error << " " << mp_time << " " << mp_error
+            << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  double h               = ( argc > 1 ) ? atof( argv[ 1 ] ) : 0.5;
+  unsigned int maxRadius = ( argc > 2 ) ? atoi( argv[ 2 ] ) : 10;
+  benchmarkNormals( h, maxRadius );
+  return 0;
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
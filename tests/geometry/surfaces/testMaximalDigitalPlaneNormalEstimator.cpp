@@ -0,0 +1,250 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMaximalDigitalPlaneNormalEstimator.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class MaximalDigitalPlaneNormalEstimator.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include "DGtalCatch.h"
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/helpers/ShortcutsGeometry.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/geometry/surfaces/COBAGenericNaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/ChordGenericNaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/estimation/CSurfelLocalEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/CDigitalSurfaceLocalEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/MaximalDigitalPlaneNormalEstimator.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class MaximalDigitalPlaneNormalEstimator.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef DigitalSetBoundary<Z3i::KSpace,Z3i::DigitalSet>  Container;
+typedef DigitalSurface<Container>                       Surface;
+typedef COBAGenericNaivePlaneComputer<Z3i::Space, DGtal::int64_t>  COBAComputer;
+typedef ChordGenericNaivePlaneComputer<Z3i::Space, Z3i::Point, DGtal::int64_t> ChordComputer;
+
+/**
+ * @return the points of the surfels at distance at most \a r from
+ * vertex \a v in \a graph, in breadth-first order.
+ */
+template <typename Graph, typename Point>
+std::vector<Point> ballPoints( const Z3i::KSpace & K, const Graph & graph,
+                               typename Graph::Vertex v, unsigned int r )
+{
+  typedef typename Graph::Vertex Vertex;
+  std::vector<Vertex> ball( 1, v );
+  std::vector<bool> visited( graph.size(), false );
+  visited[ v ] = true;
+  std::size_t ringBegin = 0;
+  for ( unsigned int k = 1; k <= r; ++k )
+    {
+      const std::size_t ringEnd = ball.size();
+      for ( std::size_t i = ringBegin; i < ringEnd; ++i )
+        for ( typename Graph::NeighborConstIterator it = graph.neighborsBegin( ball[ i ] ),
+                itE = graph.neighborsEnd( ball[ i ] ); it != itE; ++it )
+          if ( ! visited[ *it ] )
+            {
+              visited[ *it ] = true;
+              ball.push_back( *it );
+            }
+      ringBegin = ringEnd;
+    }
+  std::vector<Point> points;
+  for ( std::size_t i = 0; i < ball.size(); ++i )
+    {
+      const typename Graph::Surfel & s = graph.surfel( ball[ i ] );
+      points.push_back( K.sCoords( K.sDirectIncident( s, K.sOrthDir( s ) ) ) );
+    }
+  return points;
+}
+
+/**
+ * Checks the radii and normals of an estimator against the independent
+ * computation at each surfel: the radius is the greatest one whose
+ * ball is a plane, the normal is the one of this ball.
+ */
+template <typename Estimator>
+bool checkAgainstNaive( const Z3i::KSpace & K, const Estimator & estimator,
+                        const typename Estimator::PlaneComputer & prototype,
+                        unsigned int maxRadius )
+{
+  typedef typename Estimator::Graph         Graph;
+  typedef typename Estimator::Point         Point;
+  typedef typename Estimator::Quantity      Quantity;
+  typedef typename Estimator::PlaneComputer PlaneComputer;
+  const Graph & graph = estimator.graph();
+  unsigned int nbok = 0;
+  for ( typename Graph::Vertex v = 0; v < graph.size(); ++v )
+    {
+      unsigned int r = 0;
+      std::vector<Point> points;
+      for ( unsigned int k = 1; k <= maxRadius; ++k )
+        {
+          points = ballPoints<Graph, Point>( K, graph, v, k );
+          PlaneComputer plane( prototype );
+          if ( ! plane.extend( points.begin(), points.end() ) ) break;
+          r = k;
+        }
+      std::vector<Z3i::SCell> surfel( 1, graph.surfel( v ) );
+      if ( r != estimator.radius( surfel[ 0 ] ) ) continue;
+      points = ballPoints<Graph, Point>( K, graph, v, r );
+      PlaneComputer plane( prototype );
+      plane.extend( points.begin(), points.end() );
+      Quantity n;
+      plane.getUnitNormal( n );
+      // Oriented as the trivial normal, which replaces normals of
+      // degenerate balls orthogonal to it.
+      const Dimension k = K.sOrthDir( surfel[ 0 ] );
+      Quantity t;
+      t[ k ] = K.sDirect( surfel[ 0 ], k ) ? -1.0 : 1.0;
+      const Quantity expected = n.dot( t ) > 0.0 ? n : ( n.dot( t ) < 0.0 ? -n : t );
+      const Quantity estimated = estimator.eval( surfel.begin() );
+      nbok += ( expected - estimated ).norm() < 1e-9 ? 1 : 0;
+    }
+  return nbok == graph.size();
+}
+
+/// @return the angle between two unit vectors.
+double angle( const Z3i::RealVector & u, const Z3i::RealVector & v )
+{
+  return std::acos( std::max( -1.0, std::min( 1.0, u.dot( v ) ) ) );
+}
+
+TEST_CASE( "Testing MaximalDigitalPlaneNormalEstimator" )
+{
+  typedef MaximalDigitalPlaneNormalEstimator<Container, COBAComputer> Estimator;
+  BOOST_CONCEPT_ASSERT(( concepts::CSurfelLocalEstimator<Estimator> ));
+  BOOST_CONCEPT_ASSERT(( concepts::CDigitalSurfaceLocalEstimator<Estimator> ));
+
+  Z3i::Domain domain( Z3i::Point::diagonal( -12 ), Z3i::Point::diagonal( 12 ) );
+  Z3i::DigitalSet shape( domain );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+    {
+      const Z3i::Point & p = *it;
+      if ( p[ 0 ] * p[ 0 ] + 2 * p[ 1 ] * p[ 1 ] + 3 * p[ 2 ] * p[ 2 ] <= 100
+           || ( p[ 0 ] >= 2 && p[ 0 ] <= 8 && p[ 1 ] >= -3 && p[ 1 ] <= 5
+                && p[ 2 ] + p[ 0 ] / 3 >= -2 && p[ 2 ] <= 7 ) )
+        shape.insertNew( p );
+    }
+  Z3i::KSpace K;
+  REQUIRE( K.init( domain.lowerBound() - Z3i::Point::diagonal( 1 ),
+                   domain.upperBound() + Z3i::Point::diagonal( 1 ), true ) );
+  SurfelAdjacency<3> sAdj( true );
+  Surface surface( new Container( K, shape, sAdj ) ); // acquired
+
+  SECTION( "Radii and normals are the ones of independent computations" )
+    {
+      const unsigned int maxRadius = 6;
+      COBAComputer prototype;
+      prototype.init( 100, 1, 1 );
+      Estimator estimator( surface );
+      estimator.setParams( prototype, maxRadius );
+      estimator.init( 1.0, surface.begin(), surface.end() );
+      REQUIRE( estimator.isValid() );
+      REQUIRE( estimator.graph().size() == surface.size() );
+      REQUIRE( checkAgainstNaive( K, estimator, prototype, maxRadius ) );
+
+      typedef MaximalDigitalPlaneNormalEstimator<Container, ChordComputer> ChordEstimator;
+      ChordComputer chord;
+      chord.init( 1, 1 );
+      ChordEstimator chordEstimator;
+      chordEstimator.attach( surface );
+      chordEstimator.setParams( chord, maxRadius );
+      chordEstimator.init( 1.0, surface.begin(), surface.end() );
+      REQUIRE( checkAgainstNaive( K, chordEstimator, chord, maxRadius ) );
+    }
+
+  SECTION( "Normals are outward unit vectors" )
+    {
+      COBAComputer prototype;
+      prototype.init( 100, 1, 1 );
+      Estimator estimator( surface );
+      estimator.setParams( prototype, 8 );
+      estimator.init( 1.0, surface.begin(), surface.end() );
+      std::vector<Z3i::RealVector> normals;
+      estimator.eval( surface.begin(), surface.end(), std::back_inserter( normals ) );
+      REQUIRE( normals.size() == surface.size() );
+      unsigned int nbok = 0;
+      unsigned int i = 0;
+      for ( Surface::ConstIterator it = surface.begin(), itE = surface.end();
+            it != itE; ++it, ++i )
+        {
+          const Dimension k = K.sOrthDir( *it );
+          const double t = K.sDirect( *it, k ) ? -1.0 : 1.0;
+          nbok += ( std::fabs( normals[ i ].norm() - 1.0 ) < 1e-9
+                    && normals[ i ][ k ] * t > 0.0
+                    && normals[ i ] == estimator.eval( it ) ) ? 1 : 0;
+        }
+      REQUIRE( nbok == surface.size() );
+    }
+}
+
+TEST_CASE( "Accuracy of MaximalDigitalPlaneNormalEstimator on an ellipsoid" )
+{
+  typedef Shortcuts<Z3i::KSpace>         SH3;
+  typedef ShortcutsGeometry<Z3i::KSpace> SHG3;
+  typedef SH3::DigitalSurface::DigitalSurfaceContainer SurfaceContainer;
+  typedef MaximalDigitalPlaneNormalEstimator<SurfaceContainer, COBAComputer> Estimator;
+  auto params = SH3::defaultParameters() | SHG3::defaultParameters();
+  params( "polynomial", "x^2+2*y^2+3*z^2-100" )( "minAABB", -11. )( "maxAABB", 11. )
+    ( "gridstep", 0.5 )( "verbose", 0 );
+  auto implicit_shape  = SH3::makeImplicitShape3D( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto K               = SH3::getKSpace( params );
+  auto surface         = SH3::makeDigitalSurface( digitized_shape, K, params );
+  auto surfels         = SH3::getSurfelRange( surface, params );
+  auto true_normals    = SHG3::getNormalVectors( implicit_shape, K, surfels, params );
+
+  COBAComputer prototype;
+  prototype.init( 100, 1, 1 );
+  Estimator estimator( surface );
+  estimator.setParams( prototype, 10 );
+  estimator.init( 0.5, surfels.begin(), surfels.end() );
+  SH3::RealVectors mp_normals;
+  estimator.eval( surfels.begin(), surfels.end(), std::back_inserter( mp_normals ) );
+  REQUIRE( mp_normals.size() == surfels.size() );
+
+  double mp_error = 0.0;
+  for ( std::size_t i = 0; i < surfels.size(); ++i )
+    mp_error += angle( mp_normals[ i ], true_normals[ i ] );
+  mp_error /= surfels.size();
+  INFO( "mean angle error " << mp_error );
+  REQUIRE( mp_error < 0.15 );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -29,6 +29,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
+#include <cstdlib>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/PointVector.h"
 
@@ -38,6 +40,7 @@
 #include "DGtal/geometry/tools/determinant/COrientationFunctor2.h"
 #include "DGtal/geometry/tools/determinant/InHalfPlaneBy2x2DetComputer.h"
 #include "DGtal/geometry/tools/determinant/InHalfPlaneBySimple3x3Matrix.h"
+#include "DGtal/geometry/tools/determinant/InHalfPlaneByBatchFilter.h"
 
 #include "DGtal/geometry/tools/determinant/InGeneralizedDiskOfGivenRadius.h"
 ///////////////////////////////////////////////////////////////////////////////
@@ -91,6 +94,55 @@ bool testInHalfPlane(OrientationFunctor f)
   return nbok == nb;
 }
 
+/**
+ * Checks that the range operator of an orientation functor returns the
+ * signs of the values returned by a reference orientation functor.
+ * @param f any orientation functor with a range operator
+ * @param g any orientation functor
+ * @param a first point of the line
+ * @param b second point of the line
+ * @param points points to test
+ * @tparam OrientationFunctor a model of COrientationFunctor2
+ * @tparam ReferenceFunctor a model of COrientationFunctor2
+ */
+template<typename OrientationFunctor, typename ReferenceFunctor>
+bool testRangeOperator(OrientationFunctor f, ReferenceFunctor g,
+                       const typename OrientationFunctor::Point& a,
+                       const typename OrientationFunctor::Point& b,
+                       const std::vector<typename OrientationFunctor::Point>& points)
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing range operator..." );
+  trace.info() << f << endl;
+
+  typedef typename OrientationFunctor::Value Value;
+  typedef typename ReferenceFunctor::Value RefValue;
+  f.init(a, b);
+  g.init(a, b);
+  std::vector<Value> values( points.size() );
+  if ( f( points.begin(), points.end(), values.begin() ) == values.end() )
+    nbok++;
+  nb++;
+  for (unsigned int i = 0; i < points.size(); ++i)
+    {
+      const RefValue v = g( points[i] );
+      const int expected = ( v > NumberTraits<RefValue>::ZERO ) ? 1
+        : ( ( v < NumberTraits<RefValue>::ZERO ) ? -1 : 0 );
+      const int computed = ( values[i] > NumberTraits<Value>::ZERO ) ? 1
+        : ( ( values[i] < NumberTraits<Value>::ZERO ) ? -1 : 0 );
+      if ( ( expected == computed ) && ( values[i] == f( points[i] ) ) )
+        nbok++;
+      nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 /**
  * Example of a test. To be completed.
  */
@@ -285,6 +337,42 @@ int main( int argc, char** argv )
   typedef InHalfPlaneBySimple3x3Matrix<Point, DGtal::int32_t> Functor2; 
   res = res && testInHalfPlane( Functor2() );
 
+  typedef InHalfPlaneByBatchFilter<Point> Functor3;
+  res = res && testInHalfPlane( Functor3() );
+
+  {
+    std::vector<Point> points;
+    srand( 0 );
+    for (unsigned int i = 0; i < 1000; ++i)
+      points.push_back( Point( rand() % 201 - 100, rand() % 201 - 100 ) );
+    res = res && testRangeOperator( Functor1(), Functor1(), Point(-3,-7), Point(12,5), points );
+    res = res && testRangeOperator( Functor2(), Functor1(), Point(-3,-7), Point(12,5), points );
+    res = res && testRangeOperator( Functor3(), Functor1(), Point(-3,-7), Point(12,5), points );
+  }
+
+  {
+    //large coordinates, points close to the line
+    typedef PointVector<2, DGtal::int64_t> BigPoint;
+    typedef InHalfPlaneByBatchFilter<BigPoint> BigFunctor;
+    typedef AvnaimEtAl2x2DetSignComputer<DGtal::int64_t> BigDetComputer;
+    typedef InHalfPlaneBy2x2DetComputer<BigPoint, BigDetComputer> BigReference;
+    const BigPoint a( -( DGtal::int64_t(1) << 40 ) + 3, -( DGtal::int64_t(1) << 39 ) + 7 );
+    const BigPoint b( ( DGtal::int64_t(1) << 40 ) - 11, ( DGtal::int64_t(1) << 39 ) + 1 );
+    std::vector<BigPoint> points;
+    srand( 0 );
+    for (unsigned int i = 0; i < 1000; ++i)
+      {
+        //point of the line, moved by -1, 0 or 1 along each axis
+        const DGtal::int64_t k = rand() % 1001;
+        const BigPoint p = a + ( ( b - a ) / DGtal::int64_t(1000) ) * k;
+        points.push_back( p + BigPoint( rand() % 3 - 1, rand() % 3 - 1 ) );
+      }
+    points.push_back( a );
+    points.push_back( b );
+    points.push_back( a + ( b - a ) * DGtal::int64_t(2) / DGtal::int64_t(3) );
+    res = res && testRangeOperator( BigFunctor(), BigReference(), a, b, points );
+  }
+
   res = res && testInGeneralizedDiskOfGivenRadius(); 
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
@@ -0,0 +1,110 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testParallelConvexHull2D-benchmark.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Benchmark of Hull2D::parallelConvexHullAlgorithm against Andrew's
+ * algorithm on random points in a disk.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/tools/Hull2DHelpers.h"
+#include "DGtal/geometry/tools/determinant/InHalfPlaneBySimple3x3Matrix.h"
+#include "DGtal/geometry/tools/determinant/InHalfPlaneByBatchFilter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace DGtal::functions::Hull2D;
+
+typedef PointVector<2,DGtal::int32_t> Point;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking function Hull2D::parallelConvexHullAlgorithm.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Computes the convex hull of @a n random points in a disk of radius
+ * @a radius with Andrew's algorithm and by divide and conquer in
+ * chunks of @a chunkSize points, and writes both timings.
+ * @return 'true' if both hulls have the same vertices.
+ */
+bool benchmarkParallelHull( unsigned int n, int radius, std::size_t chunkSize )
+{
+  std::vector<Point> points;
+  while ( points.size() < n )
+    {
+      const Point p( rand() % ( 2*radius+1 ) - radius, rand() % ( 2*radius+1 ) - radius );
+      if ( p.dot( p ) <= radius * radius )
+        points.push_back( p );
+    }
+
+  Clock c;
+  c.startClock();
+  typedef InHalfPlaneBySimple3x3Matrix<Point, DGtal::int64_t> RefFunctor;
+  RefFunctor refFunctor;
+  PredicateFromOrientationFunctor2<RefFunctor, false, false> predicate( refFunctor );
+  std::vector<Point> expected;
+  andrewConvexHullAlgorithm( points.begin(), points.end(), std::back_inserter( expected ),
+                             predicate );
+  const double andrewTime = c.stopClock();
+
+  typedef InHalfPlaneByBatchFilter<Point> Functor;
+  Functor functor;
+  c.startClock();
+  std::vector<Point> hull;
+  parallelConvexHullAlgorithm( points.begin(), points.end(), std::back_inserter( hull ),
+                               functor, chunkSize );
+  const double parallelTime = c.stopClock();
+
+  std::cout << "# n radius chunk_size vertices t_andrew(ms) t_parallel(ms)" << std::endl;
+  std::cout << n << " " << radius << " " << chunkSize << " " << hull.size()
+            << " " << andrewTime << " " << parallelTime << std::endl;
+  if ( hull.empty() || expected.empty() ) return hull.size() == expected.size();
+  std::rotate( hull.begin(), std::min_element( hull.begin(), hull.end() ), hull.end() );
+  std::rotate( expected.begin(), std::min_element( expected.begin(), expected.end() ),
+               expected.end() );
+  return hull == expected;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  unsigned int n        = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 1000000;
+  int radius            = ( argc > 2 ) ? atoi( argv[ 2 ] ) : 100000;
+  std::size_t chunkSize = ( argc > 3 ) ? atoi( argv[ 3 ] ) : 65536;
+  srand( 1 );
+  return benchmarkParallelHull( n, radius, chunkSize ) ? 0 : 1;
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
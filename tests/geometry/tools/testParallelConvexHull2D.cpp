@@ -0,0 +1,191 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testParallelConvexHull2D.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing function Hull2D::parallelConvexHullAlgorithm.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/tools/Hull2DHelpers.h"
+#include "DGtal/geometry/tools/determinant/InHalfPlaneBySimple3x3Matrix.h"
+#include "DGtal/geometry/tools/determinant/InHalfPlaneBy2x2DetComputer.h"
+#include "DGtal/geometry/tools/determinant/InHalfPlaneByBatchFilter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace DGtal::functions::Hull2D;
+
+typedef PointVector<2,DGtal::int32_t> Point;
+
+/**
+ * Rotates a closed polygon so that it begins with its smallest vertex.
+ * @param v the vertices of the polygon
+ * @return the rotated vertices
+ */
+std::vector<Point> canonical( std::vector<Point> v )
+{
+  if ( ! v.empty() )
+    std::rotate( v.begin(), std::min_element( v.begin(), v.end() ), v.end() );
+  return v;
+}
+
+/**
+ * Reference convex hull of the given points, computed by Andrew's
+ * algorithm, without collinear points.
+ * @param points any points
+ * @return the counter-clockwise oriented vertices of the convex hull
+ */
+std::vector<Point> referenceHull( const std::vector<Point>& points )
+{
+  typedef InHalfPlaneBySimple3x3Matrix<Point, DGtal::int64_t> Functor;
+  Functor functor;
+  PredicateFromOrientationFunctor2<Functor, false, false> predicate( functor );
+  std::vector<Point> res;
+  andrewConvexHullAlgorithm( points.begin(), points.end(), std::back_inserter( res ), predicate );
+  return canonical( res );
+}
+
+/**
+ * Convex hull of the given points, computed by divide and conquer.
+ * @param points any points
+ * @param f any orientation functor with a range operator
+ * @param chunkSize the number of points of each chunk
+ * @return the counter-clockwise oriented vertices of the convex hull
+ */
+template <typename Functor>
+std::vector<Point> parallelHull( const std::vector<Point>& points, Functor f,
+                                 std::size_t chunkSize )
+{
+  std::vector<Point> res;
+  parallelConvexHullAlgorithm( points.begin(), points.end(), std::back_inserter( res ),
+                               f, chunkSize );
+  return canonical( res );
+}
+
+/**
+ * @param n number of points
+ * @param radius radius of the disk containing the points
+ * @return random points in a disk
+ */
+std::vector<Point> randomPointsInDisk( unsigned int n, int radius )
+{
+  std::vector<Point> points;
+  while ( points.size() < n )
+    {
+      const Point p( rand() % ( 2*radius+1 ) - radius, rand() % ( 2*radius+1 ) - radius );
+      if ( p.dot( p ) <= radius * radius )
+        points.push_back( p );
+    }
+  return points;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing function Hull2D::parallelConvexHullAlgorithm.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing parallelConvexHullAlgorithm on small inputs" )
+{
+  typedef InHalfPlaneByBatchFilter<Point> Functor;
+
+  SECTION( "Empty, single and duplicated points" )
+    {
+      std::vector<Point> points;
+      REQUIRE( parallelHull( points, Functor(), 4 ).empty() );
+      points.push_back( Point( 3, 4 ) );
+      REQUIRE( parallelHull( points, Functor(), 4 ) == points );
+      points.push_back( Point( 3, 4 ) );
+      points.push_back( Point( 3, 4 ) );
+      REQUIRE( parallelHull( points, Functor(), 1 ).size() == 1 );
+    }
+
+  SECTION( "Collinear points" )
+    {
+      std::vector<Point> points;
+      for ( int i = 10; i >= -10; --i )
+        points.push_back( Point( 2*i, 3*i ) );
+      const std::vector<Point> hull = parallelHull( points, Functor(), 3 );
+      REQUIRE( hull.size() == 2 );
+      REQUIRE( hull[ 0 ] == Point( -20, -30 ) );
+      REQUIRE( hull[ 1 ] == Point( 20, 30 ) );
+    }
+
+  SECTION( "Square with inner and boundary points" )
+    {
+      std::vector<Point> points;
+      for ( int x = 0; x <= 10; ++x )
+        for ( int y = 0; y <= 10; ++y )
+          points.push_back( Point( x, y ) );
+      std::vector<Point> expected;
+      expected.push_back( Point( 0, 0 ) );
+      expected.push_back( Point( 10, 0 ) );
+      expected.push_back( Point( 10, 10 ) );
+      expected.push_back( Point( 0, 10 ) );
+      for ( std::size_t chunkSize = 1; chunkSize <= 128; chunkSize *= 2 )
+        {
+          INFO( "chunk size " << chunkSize );
+          REQUIRE( parallelHull( points, Functor(), chunkSize ) == expected );
+        }
+    }
+}
+
+TEST_CASE( "Testing parallelConvexHullAlgorithm against Andrew's algorithm" )
+{
+  srand( 0 );
+  const std::vector<Point> points = randomPointsInDisk( 20000, 1000 );
+  const std::vector<Point> expected = referenceHull( points );
+  REQUIRE( expected.size() > 3 );
+
+  SECTION( "With a batch filter" )
+    {
+      typedef InHalfPlaneByBatchFilter<Point> Functor;
+      REQUIRE( parallelHull( points, Functor(), 65536 ) == expected );
+      REQUIRE( parallelHull( points, Functor(), 1000 ) == expected );
+      REQUIRE( parallelHull( points, Functor(), 7 ) == expected );
+    }
+
+  SECTION( "With a 2x2 determinant computer" )
+    {
+      typedef AvnaimEtAl2x2DetSignComputer<DGtal::int64_t> DetComputer;
+      typedef InHalfPlaneBy2x2DetComputer<Point, DetComputer> Functor;
+      REQUIRE( parallelHull( points, Functor(), 1000 ) == expected );
+    }
+
+  SECTION( "With a 3x3 matrix" )
+    {
+      typedef InHalfPlaneBySimple3x3Matrix<Point, DGtal::int64_t> Functor;
+      REQUIRE( parallelHull( points, Functor(), 1000 ) == expected );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,120 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBitPackedCellCover-benchmark.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Benchmark of the full convexity check of DigitalConvexity on many
+ * tetrahedra (with BitPackedCellCover) against the cell covers of
+ * CellGeometry.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/geometry/volumes/CellGeometry.h"
+#include "DGtal/geometry/volumes/DigitalConvexity.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef KhalimskySpaceND<3,int>    KSpace;
+typedef KSpace::Point              Point;
+typedef DigitalConvexity< KSpace > DConvexity;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking the full convexity checks.
+///////////////////////////////////////////////////////////////////////////////
+
+/// @return 'true' iff \a P is fully convex, computed with CellGeometry.
+bool referenceIsFullyConvex( const DConvexity& dconv,
+                             const DConvexity::LatticePolytope& P )
+{
+  std::vector< Point > S;
+  P.getPoints( S );
+  for ( Dimension k = 1; k < KSpace::dimension; ++k )
+    {
+      auto touched_cells     = dconv.makeCellCover( S.begin(), S.end(), k, k );
+      auto intersected_cells = dconv.makeCellCover( P, k, k );
+      if ( ( intersected_cells.nbCells() != touched_cells.nbCells() )
+           || ( ! intersected_cells.subset( touched_cells ) ) )
+        return false;
+    }
+  return true;
+}
+
+/**
+ * Checks the full convexity of @a nb random tetrahedra with vertices
+ * in [-@a radius,@a radius]^3, with CellGeometry and with
+ * DigitalConvexity::isFullyConvex, and writes both timings.
+ * @return 'true' if both computations agree.
+ */
+bool benchmarkFullConvexity( unsigned int nb, int radius )
+{
+  DConvexity dconv( Point( -radius-1, -radius-1, -radius-1 ),
+                    Point( radius+1, radius+1, radius+1 ) );
+  std::vector< DConvexity::LatticePolytope > polytopes;
+  while ( polytopes.size() < nb )
+    {
+      std::vector<Point> V;
+      for ( unsigned int i = 0; i < 4; ++i )
+        V.push_back( Point( rand() % ( 2*radius+1 ) - radius,
+                            rand() % ( 2*radius+1 ) - radius,
+                            rand() % ( 2*radius+1 ) - radius ) );
+      if ( ! dconv.isSimplexFullDimensional( V.begin(), V.end() ) ) continue;
+      polytopes.push_back( dconv.makeSimplex( V.begin(), V.end() ) );
+    }
+
+  Clock c;
+  c.startClock();
+  std::vector<bool> expected;
+  for ( const auto& P : polytopes )
+    expected.push_back( referenceIsFullyConvex( dconv, P ) );
+  const double t_ref = c.stopClock();
+  c.startClock();
+  std::vector<bool> convex;
+  dconv.isFullyConvex( polytopes, convex );
+  const double t_bits = c.stopClock();
+
+  std::cout << "# nb radius t_cell_geometry(ms) t_bit_packed(ms)" << std::endl;
+  std::cout << nb << " " << radius << " " << t_ref << " " << t_bits << std::endl;
+  return convex == expected;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  unsigned int nb = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 200;
+  int radius      = ( argc > 2 ) ? atoi( argv[ 2 ] ) : 40;
+  srand( 2 );
+  return benchmarkFullConvexity( nb, radius ) ? 0 : 1;
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
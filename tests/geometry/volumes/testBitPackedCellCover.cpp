@@ -0,0 +1,208 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBitPackedCellCover.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class BitPackedCellCover and the full
+ * convexity checks of DigitalConvexity.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/geometry/volumes/BitPackedCellCover.h"
+#include "DGtal/geometry/volumes/CellGeometry.h"
+#include "DGtal/geometry/volumes/DigitalConvexity.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+/// Checks that the cells of a bit-packed cover of polytope \a P are
+/// the ones computed by CellGeometry.
+template <typename KSpace>
+void checkCover( const KSpace& K,
+                 const typename DigitalConvexity<KSpace>::LatticePolytope& P,
+                 Dimension min_dim, Dimension max_dim )
+{
+  typedef typename KSpace::Point Point;
+  typedef BitPackedCellCover< KSpace > Cover;
+  CellGeometry< KSpace > ref_touched    ( K, min_dim, max_dim );
+  CellGeometry< KSpace > ref_intersected( K, min_dim, max_dim );
+  std::vector<Point> S;
+  P.getPoints( S );
+  ref_touched.addCellsTouchingPoints( S.begin(), S.end() );
+  ref_intersected.addCellsTouchingPolytope( P );
+  Cover touched    ( P.getDomain().lowerBound(), P.getDomain().upperBound(), min_dim, max_dim );
+  Cover intersected( P.getDomain().lowerBound(), P.getDomain().upperBound(), min_dim, max_dim );
+  touched.addCellsTouchingPolytopePoints( P );
+  intersected.addCellsTouchingPolytope( P );
+  CAPTURE( min_dim );
+  CAPTURE( max_dim );
+  REQUIRE( touched.nbCells()     == ref_touched.nbCells() );
+  REQUIRE( intersected.nbCells() == ref_intersected.nbCells() );
+  for ( auto&& p : S )
+    {
+      auto cells = K.uCoFaces( K.uPointel( p ) );
+      cells.push_back( K.uPointel( p ) );
+      for ( auto&& c : cells )
+        if ( min_dim <= K.uDim( c ) && K.uDim( c ) <= max_dim )
+          REQUIRE( touched.test( K.uKCoords( c ) ) );
+    }
+  for ( Dimension i = min_dim; i <= max_dim; ++i )
+    for ( auto&& kp : ref_intersected.getIntersectedKPoints( P, i ) )
+      REQUIRE( intersected.test( kp ) );
+  REQUIRE( touched.subset( intersected ) );
+  REQUIRE( touched.equals( intersected )
+           == ( ref_intersected.nbCells() == ref_touched.nbCells()
+                && ref_intersected.subset( ref_touched ) ) );
+}
+
+/// @return 'true' iff \a P is fully convex, computed with CellGeometry.
+template <typename KSpace>
+bool referenceIsFullyConvex( const DigitalConvexity<KSpace>& dconv,
+                             const typename DigitalConvexity<KSpace>::LatticePolytope& P )
+{
+  std::vector< typename KSpace::Point > S;
+  P.getPoints( S );
+  for ( Dimension k = 1; k < KSpace::dimension; ++k )
+    {
+      auto touched_cells     = dconv.makeCellCover( S.begin(), S.end(), k, k );
+      auto intersected_cells = dconv.makeCellCover( P, k, k );
+      if ( ( intersected_cells.nbCells() != touched_cells.nbCells() )
+           || ( ! intersected_cells.subset( touched_cells ) ) )
+        return false;
+    }
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class BitPackedCellCover.
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "BitPackedCellCover< K2 > unit tests", "[cell_cover][2d]" )
+{
+  typedef KhalimskySpaceND<2,int>          KSpace;
+  typedef KSpace::Point                    Point;
+  typedef BitPackedCellCover< KSpace >     Cover;
+  typedef DigitalConvexity< KSpace >       DConvexity;
+
+  DConvexity dconv( Point( -100, -100 ), Point( 100, 100 ) );
+  GIVEN( "An empty cover of the box (0,0)-(2,1)" ) {
+    Cover C( Point( 0, 0 ), Point( 2, 1 ), 1, 1 );
+    THEN( "It contains no cell" ) {
+      REQUIRE( C.nbCells() == 0 );
+      REQUIRE( ! C.test( Point( 1, 0 ) ) );
+      REQUIRE( ! C.test( Point( 100, 0 ) ) );
+    }
+    THEN( "Only cells of the right dimension are inserted" ) {
+      C.set( Point( 1, 0 ) );
+      C.set( Point( 0, 0 ) );
+      C.set( Point( 1, 1 ) );
+      C.set( Point( -1, 2 ) );
+      REQUIRE( C.nbCells() == 2 );
+      REQUIRE( C.test( Point( 1, 0 ) ) );
+      REQUIRE( C.test( Point( -1, 2 ) ) );
+      REQUIRE( ! C.test( Point( 0, 0 ) ) );
+    }
+  }
+  GIVEN( "Random triangles" ) {
+    srand( 0 );
+    for ( unsigned int n = 0; n < 50; ++n )
+      {
+        std::vector<Point> V;
+        for ( unsigned int i = 0; i < 3; ++i )
+          V.push_back( Point( rand() % 81 - 40, rand() % 81 - 40 ) );
+        if ( ! dconv.isSimplexFullDimensional( V.begin(), V.end() ) ) continue;
+        auto P = dconv.makeSimplex( V.begin(), V.end() );
+        checkCover( dconv.space(), P, 0, 2 );
+        checkCover( dconv.space(), P, 1, 1 );
+        checkCover( dconv.space(), P, 0, 1 );
+        REQUIRE( dconv.isFullyConvex( P ) == referenceIsFullyConvex( dconv, P ) );
+      }
+  }
+}
+
+SCENARIO( "BitPackedCellCover< K3 > unit tests", "[cell_cover][3d]" )
+{
+  typedef KhalimskySpaceND<3,int>          KSpace;
+  typedef KSpace::Point                    Point;
+  typedef DigitalConvexity< KSpace >       DConvexity;
+
+  DConvexity dconv( Point( -100, -100, -100 ), Point( 100, 100, 100 ) );
+  GIVEN( "The unit tetrahedron" ) {
+    auto P = dconv.makeSimplex( { Point( 0, 0, 0 ), Point( 1, 0, 0 ),
+                                  Point( 0, 1, 0 ), Point( 0, 0, 1 ) } );
+    THEN( "It is fully convex" ) {
+      REQUIRE( dconv.isKConvex( P, 1 ) );
+      REQUIRE( dconv.isKConvex( P, 2 ) );
+      REQUIRE( dconv.isFullyConvex( P ) );
+    }
+  }
+  GIVEN( "Random tetrahedra" ) {
+    srand( 1 );
+    std::vector< DConvexity::LatticePolytope > polytopes;
+    while ( polytopes.size() < 50 )
+      {
+        std::vector<Point> V;
+        for ( unsigned int i = 0; i < 4; ++i )
+          V.push_back( Point( rand() % 4, rand() % 4, rand() % 4 ) );
+        if ( ! dconv.isSimplexFullDimensional( V.begin(), V.end() ) ) continue;
+        polytopes.push_back( dconv.makeSimplex( V.begin(), V.end() ) );
+      }
+    THEN( "Their covers are the ones of CellGeometry" ) {
+      for ( const auto& P : polytopes )
+        {
+          checkCover( dconv.space(), P, 0, 3 );
+          checkCover( dconv.space(), P, 1, 2 );
+          checkCover( dconv.space(), P, 2, 2 );
+        }
+    }
+    THEN( "Their full convexity is the one computed with CellGeometry" ) {
+      std::vector<bool> convex;
+      dconv.isFullyConvex( polytopes, convex );
+      REQUIRE( convex.size() == polytopes.size() );
+      unsigned int nb_convex = 0;
+      for ( std::size_t i = 0; i < polytopes.size(); ++i )
+        {
+          const bool ref = referenceIsFullyConvex( dconv, polytopes[ i ] );
+          REQUIRE( convex[ i ] == ref );
+          REQUIRE( dconv.isFullyConvex( polytopes[ i ] ) == ref );
+          REQUIRE( ( dconv.isKConvex( polytopes[ i ], 1 )
+                     && dconv.isKConvex( polytopes[ i ], 2 ) ) == ref );
+          nb_convex += ref ? 1 : 0;
+        }
+      REQUIRE( 0 < nb_convex );
+      REQUIRE( nb_convex < polytopes.size() );
+    }
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,85 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBoundedLatticePolytope-benchmark.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Benchmark of the line by line counting of BoundedLatticePolytope
+ * against a point by point enumeration of its domain.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/geometry/volumes/BoundedLatticePolytope.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef SpaceND<3,int>                  Space;
+typedef Space::Point                    Point;
+typedef Space::Integer                  Integer;
+typedef BoundedLatticePolytope< Space > Polytope;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class BoundedLatticePolytope.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Counts the points of a simplex whose vertices are scaled by @a
+ * scale, point by point and line by line, and writes both timings.
+ * @return 'true' if both counts agree.
+ */
+bool benchmarkCount( int scale )
+{
+  Polytope P { Point( 0, 0, 0 ), Point( 30, 2, 1 ) * scale,
+               Point( -3, 25, 4 ) * scale, Point( 2, -4, 28 ) * scale };
+  Clock c;
+  c.startClock();
+  Integer nb_brute = 0;
+  for ( const Point& p : P.getDomain() )
+    if ( P.isDomainPointInside( p ) ) ++nb_brute;
+  const double t_brute = c.stopClock();
+  c.startClock();
+  const Integer nb = P.count();
+  const double t_scan = c.stopClock();
+
+  std::cout << "# scale nb_points t_point_by_point(ms) t_line_by_line(ms)" << std::endl;
+  std::cout << scale << " " << nb << " " << t_brute << " " << t_scan << std::endl;
+  return nb == nb_brute;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  int scale = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 10;
+  return benchmarkCount( scale ) ? 0 : 1;
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -31,6 +31,8 @@
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include <set>
+#include <cstdlib>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/geometry/volumes/BoundedLatticePolytope.h"
@@ -313,5 +315,87 @@ SCENARIO( "BoundedLatticePolytope< Z3 > unit tests", "[lattice_polytope][3d]" )
   }
 }
 
+/// Checks the counting and enumeration services of \a P against
+/// the predicates evaluated at every point of its domain.
+template <typename Polytope>
+void checkEnumeration( const Polytope& P )
+{
+  typedef typename Polytope::Point Point;
+  std::vector<Point> inside, interior, boundary;
+  for ( const Point& p : P.getDomain() )
+    {
+      if ( P.isDomainPointInside( p ) ) inside.push_back( p );
+      if ( P.isInterior( p ) )          interior.push_back( p );
+      if ( P.isBoundary( p ) )          boundary.push_back( p );
+    }
+  std::vector<Point> pts;
+  P.getPoints( pts );
+  REQUIRE( pts == inside );
+  P.getInteriorPoints( pts );
+  REQUIRE( pts == interior );
+  P.getBoundaryPoints( pts );
+  REQUIRE( pts == boundary );
+  REQUIRE( P.count()         == typename Polytope::Integer( inside.size() ) );
+  REQUIRE( P.countInterior() == typename Polytope::Integer( interior.size() ) );
+  REQUIRE( P.countBoundary() == typename Polytope::Integer( boundary.size() ) );
+  std::set<Point> pts_set;
+  P.insertPoints( pts_set );
+  REQUIRE( pts_set == std::set<Point>( inside.begin(), inside.end() ) );
+  const auto n = P.count();
+  REQUIRE( P.countUpTo( n + 1 ) == n );
+  if ( n > 1 ) REQUIRE( P.countUpTo( n - 1 ) == n - 1 );
+  const Point lo = P.getDomain().lowerBound();
+  const Point hi = P.getDomain().upperBound();
+  const Point mid = ( lo + hi ) / 2;
+  std::size_t nb_within = 0;
+  for ( const Point& p : inside )
+    if ( p.inf( mid ) == p ) ++nb_within;
+  REQUIRE( P.countWithin( lo - Point::diagonal( 3 ), mid )
+           == typename Polytope::Integer( nb_within ) );
+}
+
+SCENARIO( "BoundedLatticePolytope scanline enumeration", "[lattice_polytope][enumeration]" )
+{
+  GIVEN( "Random 2D triangles, closed and partially open" ) {
+    typedef SpaceND<2,int>                   Space;
+    typedef Space::Point                     Point;
+    typedef BoundedLatticePolytope< Space >  Polytope;
+    srand( 0 );
+    for ( unsigned int n = 0; n < 20; ++n )
+      {
+        Point a( rand() % 31 - 15, rand() % 31 - 15 );
+        Point b( rand() % 31 - 15, rand() % 31 - 15 );
+        Point c( rand() % 31 - 15, rand() % 31 - 15 );
+        Polytope P { a, b, c };
+        if ( ! P.isValid() ) continue;
+        checkEnumeration( P );
+        Polytope Q = P + Polytope::LeftStrictUnitCell( { 0, 1 } );
+        checkEnumeration( Q );
+        Polytope R = P + Polytope::RightStrictUnitSegment( 0 );
+        R.cut( Point( 1, 2 ), 1, false );
+        checkEnumeration( R );
+      }
+  }
+  GIVEN( "Random 3D simplices, closed and partially open" ) {
+    typedef SpaceND<3,int>                   Space;
+    typedef Space::Point                     Point;
+    typedef BoundedLatticePolytope< Space >  Polytope;
+    srand( 1 );
+    for ( unsigned int n = 0; n < 20; ++n )
+      {
+        std::vector<Point> V;
+        for ( unsigned int i = 0; i < 4; ++i )
+          V.push_back( Point( rand() % 21 - 10, rand() % 21 - 10, rand() % 21 - 10 ) );
+        Polytope P( V.begin(), V.end() );
+        if ( ! P.isValid() ) continue;
+        checkEnumeration( P );
+        Polytope Q = P + Polytope::LeftStrictUnitSegment( 1 );
+        checkEnumeration( Q );
+        Polytope R = P + Polytope::RightStrictUnitCell( { 0, 2 } );
+        checkEnumeration( R );
+      }
+  }
+}
+
 //                                                                           //
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,94 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testKanungo-benchmark.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Benchmark of the generation of several noisy versions of a 3D ball
+ * with KanungoNoise and with KanungoNoiseGenerator.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/KanungoNoise.h"
+#include "DGtal/geometry/volumes/KanungoNoiseGenerator.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking Kanungo noise generation.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Generates @a nb_variants noisy versions of a ball of radius
+ * size/2-7 in a cubic domain of side @a size, with KanungoNoise and
+ * with KanungoNoiseGenerator, and writes both timings.
+ */
+void benchmarkKanungo3D( unsigned int size, unsigned int nb_variants, double alpha )
+{
+  const Z3i::Integer side = size;
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( side - 1, side - 1, side - 1 ) );
+  Z3i::DigitalSet set( domain );
+  Shapes<Z3i::Domain>::addNorm2Ball( set, Z3i::Point( side / 2, side / 2, side / 2 ),
+                                     side / 2 - 7 );
+
+  Clock c;
+  c.startClock();
+  for ( unsigned int i = 0; i < nb_variants; ++i )
+    KanungoNoise<Z3i::DigitalSet, Z3i::Domain> nosifiedObject( set, domain, alpha );
+  const double t_kanungo = c.stopClock();
+
+  typedef ImageContainerBySTLVector< Z3i::Domain, unsigned char > Image;
+  c.startClock();
+  KanungoNoiseGenerator<Z3i::DigitalSet, Z3i::Domain> generator( set, domain );
+  Image image( domain );
+  for ( unsigned int i = 0; i < nb_variants; ++i )
+    generator.generate( alpha, i, image );
+  const double t_generator = c.stopClock();
+
+  std::cout << "# size nb_variants alpha t_kanungo(ms) t_generator(ms)" << std::endl;
+  std::cout << size << " " << nb_variants << " " << alpha << " "
+            << t_kanungo << " " << t_generator << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  unsigned int size        = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 64;
+  unsigned int nb_variants = ( argc > 2 ) ? atoi( argv[ 2 ] ) : 10;
+  double alpha             = ( argc > 3 ) ? atof( argv[ 3 ] ) : 0.5;
+  benchmarkKanungo3D( size, nb_variants, alpha );
+  return 0;
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
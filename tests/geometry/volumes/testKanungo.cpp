@@ -31,6 +31,9 @@
 #include <iostream>
 #include "DGtal/base/Common.h"
 #include "DGtal/geometry/volumes/KanungoNoise.h"
+#include "DGtal/geometry/volumes/KanungoNoiseGenerator.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/topology/BitPackedOccupancy.h"
 #include "DGtal/io/boards/Board2D.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/shapes/Shapes.h"
@@ -93,6 +96,113 @@ bool testKanungo2D()
   return nbok == nb;
 }
 
+/**
+ * Checks that the noisy versions of KanungoNoiseGenerator are
+ * reproducible, the same in images and occupancy grids, and unchanged
+ * far from the border.
+ */
+bool testKanungoGenerator2D()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing KanungoNoiseGenerator in 2D ..." );
+
+  Z2i::Domain domain(Z2i::Point(-10,-5), Z2i::Point(118,123));
+  Z2i::DigitalSet set(domain);
+  Shapes<Z2i::Domain>::addNorm2Ball( set , Z2i::Point(54,59), 30);
+
+  typedef ImageContainerBySTLVector< Z2i::Domain, unsigned char > Image;
+  KanungoNoiseGenerator<Z2i::DigitalSet, Z2i::Domain> generator( set, domain );
+  Image image1( domain ), image2( domain ), image3( domain );
+  BitPackedOccupancy< Z2i::Space > occupancy( domain.lowerBound(), domain.upperBound() );
+  generator.generate( 0.5, 7, image1 );
+  generator.generate( 0.5, 7, image2 );
+  generator.generate( 0.5, 8, image3 );
+  generator.generate( 0.5, 7, occupancy );
+
+  bool same_values = true, same_occupancy = true, unchanged_far = true;
+  unsigned int nb_diff_seeds = 0, nb_flips = 0;
+  for ( auto p : domain )
+    {
+      const bool v = image1( p ) != 0;
+      same_values    = same_values && ( v == generator.isInside( p, 0.5, 7 ) )
+        && ( image1( p ) == image2( p ) );
+      same_occupancy = same_occupancy && ( v == occupancy( p ) );
+      nb_diff_seeds += ( image1( p ) != image3( p ) ) ? 1 : 0;
+      nb_flips      += ( v != set( p ) ) ? 1 : 0;
+      if ( ( p - Z2i::Point(54,59) ).norm() < 15.0
+           || ( p - Z2i::Point(54,59) ).norm() > 45.0 )
+        unchanged_far = unchanged_far && ( v == set( p ) );
+    }
+  trace.info() << nb_flips << " flips, " << nb_diff_seeds
+               << " differences between two seeds" << std::endl;
+  nbok += same_values ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same noisy version for the same seed" << std::endl;
+  nbok += same_occupancy ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same noisy version in images and occupancy grids" << std::endl;
+  nbok += ( nb_flips > 0 && nb_diff_seeds > 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "noisy versions depend on the seed" << std::endl;
+  nbok += unchanged_far ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "points far from the border are unchanged" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Checks the flip probability of KanungoNoiseGenerator on the points
+ * next to the border of a 3D ball.
+ */
+bool testKanungoGenerator3D()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing KanungoNoiseGenerator in 3D ..." );
+
+  Z3i::Domain domain(Z3i::Point(0,0,0), Z3i::Point(31,31,31));
+  Z3i::DigitalSet set(domain);
+  Shapes<Z3i::Domain>::addNorm2Ball( set , Z3i::Point(16,16,16), 12);
+  const double alpha = 0.5;
+  const unsigned int nb_variants = 10;
+
+  typedef ImageContainerBySTLVector< Z3i::Domain, unsigned char > Image;
+  KanungoNoiseGenerator<Z3i::DigitalSet, Z3i::Domain> generator( set, domain );
+  Image image( domain );
+  unsigned int nb_border = 0, nb_border_flips = 0;
+  for ( unsigned int i = 0; i < nb_variants; ++i )
+    {
+      generator.generate( alpha, i, image );
+      // Inside points next to the outside are flipped with probability alpha^2.
+      for ( auto p : domain )
+        if ( set( p ) && ( ! set( p + Z3i::Point( 1, 0, 0 ) )
+                           || ! set( p - Z3i::Point( 1, 0, 0 ) ) ) )
+          {
+            nb_border       += 1;
+            nb_border_flips += image( p ) == 0 ? 1 : 0;
+          }
+    }
+  const double rate = (double) nb_border_flips / (double) nb_border;
+  trace.info() << "Flip rate of " << nb_border << " border points: " << rate
+               << " (expected " << alpha * alpha << ")" << std::endl;
+  nbok += std::abs( rate - alpha * alpha ) < 0.02 ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "flip rate of border points is alpha^2" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 bool CheckingConcept()
 {
   BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate < KanungoNoise<Z2i::DigitalSet, Z2i::Domain> > ));
@@ -111,7 +221,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = CheckingConcept() && testKanungo2D(); // && ... other tests
+  bool res = CheckingConcept() && testKanungo2D()
+    && testKanungoGenerator2D() && testKanungoGenerator3D(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,103 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testLatticeQuickHull3D-benchmark.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Benchmark of LatticeQuickHull3D on random points in a ball,
+ * computed in one chunk and by chunks, and of the construction of
+ * its lattice polytope.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/geometry/volumes/LatticeQuickHull3D.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef SpaceND< 3, DGtal::int64_t > Space;
+typedef Space::Point                 Point;
+typedef LatticeQuickHull3D< Space >  QuickHull;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class LatticeQuickHull3D.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Computes the hull of @a n random points in a ball of radius @a
+ * radius, in one chunk and by chunks, then its lattice polytope, and
+ * writes the timings.
+ * @return 'true' if both hulls have the same number of facets.
+ */
+bool benchmarkQuickHull( unsigned int n, int radius )
+{
+  std::vector<Point> points;
+  while ( points.size() < n )
+    {
+      const Point p( rand() % ( 2*radius+1 ) - radius,
+                     rand() % ( 2*radius+1 ) - radius,
+                     rand() % ( 2*radius+1 ) - radius );
+      if ( p.dot( p ) <= radius * radius )
+        points.push_back( p );
+    }
+
+  Clock c;
+  QuickHull hull1, hull2;
+  c.startClock();
+  hull1.compute( points.begin(), points.end(), points.size() );
+  const double t1 = c.stopClock();
+  c.startClock();
+  hull2.compute( points.begin(), points.end() );
+  const double t2 = c.stopClock();
+  c.startClock();
+  QuickHull::LatticePolytope P = hull2.makePolytope();
+  const double t3 = c.stopClock();
+
+  std::cout << "# n radius vertices facets t_one_chunk(ms) t_chunks(ms) t_polytope(ms)"
+            << std::endl;
+  std::cout << n << " " << radius << " " << hull2.vertices().size()
+            << " " << hull2.facets().size() << " " << t1 << " " << t2
+            << " " << t3 << std::endl;
+  return hull1.facets().size() == hull2.facets().size()
+    && P.nbHalfSpaces() >= hull2.facets().size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  unsigned int n = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 1000000;
+  int radius     = ( argc > 2 ) ? atoi( argv[ 2 ] ) : 1000;
+  srand( 1 );
+  return benchmarkQuickHull( n, radius ) ? 0 : 1;
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
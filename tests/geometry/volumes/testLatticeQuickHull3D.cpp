@@ -0,0 +1,259 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testLatticeQuickHull3D.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class LatticeQuickHull3D.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <map>
+#include <set>
+#include <algorithm>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/geometry/volumes/LatticeQuickHull3D.h"
+#include "DGtal/geometry/volumes/DigitalConvexity.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef SpaceND<3,int>                   Space;
+typedef Space::Point                     Point;
+typedef Space::Vector                    Vector;
+typedef LatticeQuickHull3D< Space >      QuickHull;
+typedef QuickHull::LatticePolytope       Polytope;
+
+/**
+ * Checks that the triangles of the hull form a closed convex surface
+ * containing the given points, which certifies the convex hull.
+ * @param hull a hull of dimension 3.
+ * @param points the points given to the hull.
+ * @return 'true' if the hull is valid.
+ */
+template <typename THull, typename TPoint>
+bool checkPolyhedron( const THull& hull, const std::vector<TPoint>& points )
+{
+  typedef typename THull::Index Index;
+  typedef typename THull::Vector TVector;
+  const auto& V = hull.vertices();
+  const auto& T = hull.triangles();
+  // closed surface of genus 0
+  std::map< std::pair<Index,Index>, Index > opposite;
+  for ( auto&& t : T )
+    for ( unsigned int i = 0; i < 3; ++i )
+      opposite[ std::make_pair( t[ i ], t[ (i+1)%3 ] ) ] = t[ (i+2)%3 ];
+  if ( opposite.size() != 3 * T.size() ) return false;
+  for ( auto&& e : opposite )
+    if ( opposite.count( std::make_pair( e.first.second, e.first.first ) ) != 1 )
+      return false;
+  const long euler = long( V.size() ) - long( opposite.size() / 2 ) + long( T.size() );
+  if ( euler != 2 ) return false;
+  // locally convex, containing the points
+  for ( auto&& t : T )
+    {
+      const TVector n = ( V[ t[ 1 ] ] - V[ t[ 0 ] ] ).crossProduct( V[ t[ 2 ] ] - V[ t[ 0 ] ] );
+      if ( n == TVector::zero ) return false;
+      for ( auto&& p : points )
+        if ( n.dot( p - V[ t[ 0 ] ] ) > 0 ) return false;
+    }
+  // vertices are input points
+  std::set<TPoint> input( points.begin(), points.end() );
+  for ( auto&& v : V )
+    if ( input.count( v ) == 0 ) return false;
+  return true;
+}
+
+/**
+ * @param hull any hull.
+ * @return the set of its facets.
+ */
+template <typename THull>
+std::set< std::pair< typename THull::Vector, typename THull::Integer > >
+facetSet( const THull& hull )
+{
+  std::set< std::pair< typename THull::Vector, typename THull::Integer > > F;
+  for ( auto&& h : hull.facets() ) F.insert( std::make_pair( h.N, h.c ) );
+  return F;
+}
+
+/**
+ * @param n number of points
+ * @param radius radius of the ball containing the points
+ * @return random points in a ball
+ */
+template <typename TPoint>
+std::vector<TPoint> randomPointsInBall( unsigned int n, int radius )
+{
+  std::vector<TPoint> points;
+  while ( points.size() < n )
+    {
+      const TPoint p( rand() % ( 2*radius+1 ) - radius,
+                      rand() % ( 2*radius+1 ) - radius,
+                      rand() % ( 2*radius+1 ) - radius );
+      if ( p.dot( p ) <= radius * radius )
+        points.push_back( p );
+    }
+  return points;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class LatticeQuickHull3D.
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "LatticeQuickHull3D degenerated point sets", "[quickhull][3d]" )
+{
+  QuickHull hull;
+  GIVEN( "No point" ) {
+    std::vector<Point> points;
+    THEN( "The hull is empty" ) {
+      REQUIRE( hull.compute( points.begin(), points.end() ) == -1 );
+      REQUIRE( hull.vertices().empty() );
+      REQUIRE( ! hull.isValid() );
+    }
+  }
+  GIVEN( "Several copies of one point" ) {
+    std::vector<Point> points( 10, Point( 1, -2, 3 ) );
+    THEN( "The hull is this point" ) {
+      REQUIRE( hull.compute( points.begin(), points.end(), 4 ) == 0 );
+      REQUIRE( hull.vertices().size() == 1 );
+      Polytope P = hull.makePolytope();
+      REQUIRE( P.count() == 1 );
+      REQUIRE( P.isInside( Point( 1, -2, 3 ) ) );
+    }
+  }
+  GIVEN( "Collinear points" ) {
+    std::vector<Point> points;
+    for ( int i = 10; i >= -10; --i ) points.push_back( Point( i, 2*i, -i ) );
+    THEN( "The hull is a segment with all the points" ) {
+      REQUIRE( hull.compute( points.begin(), points.end(), 4 ) == 1 );
+      REQUIRE( hull.vertices().size() == 2 );
+      Polytope P = hull.makePolytope();
+      REQUIRE( P.count() == 21 );
+      REQUIRE( P.canBeSummed() );
+    }
+  }
+  GIVEN( "The lattice points of the plane x+2y-z=1 in a box" ) {
+    std::vector<Point> points;
+    for ( int x = -5; x <= 5; ++x )
+      for ( int y = -5; y <= 5; ++y )
+        {
+          const int z = x + 2*y - 1;
+          if ( z >= -6 && z <= 6 ) points.push_back( Point( x, y, z ) );
+        }
+    std::random_shuffle( points.begin(), points.end() );
+    THEN( "The hull is a polygon with the same lattice points" ) {
+      REQUIRE( hull.compute( points.begin(), points.end(), 17 ) == 2 );
+      REQUIRE( hull.triangles().empty() );
+      REQUIRE( hull.facets().size() == hull.vertices().size() + 2 );
+      REQUIRE( hull.facets()[ 0 ].N == -hull.facets()[ 1 ].N );
+      Polytope P = hull.makePolytope();
+      REQUIRE( P.count() == (DGtal::int64_t) points.size() );
+      for ( auto&& p : points ) REQUIRE( P.isInside( p ) );
+      REQUIRE( P.canBeSummed() );
+    }
+  }
+}
+
+SCENARIO( "LatticeQuickHull3D of lattice polytopes", "[quickhull][3d]" )
+{
+  typedef KhalimskySpaceND< 3, int > KSpace;
+  typedef DigitalConvexity< KSpace > Convexity;
+  QuickHull hull;
+  GIVEN( "The lattice points of a cube" ) {
+    std::vector<Point> points;
+    for ( int x = 0; x <= 4; ++x )
+      for ( int y = 0; y <= 4; ++y )
+        for ( int z = 0; z <= 4; ++z )
+          points.push_back( Point( x, y, z ) );
+    THEN( "Its hull has 6 facets and the same lattice points" ) {
+      REQUIRE( hull.compute( points.begin(), points.end(), 10 ) == 3 );
+      REQUIRE( checkPolyhedron( hull, points ) );
+      REQUIRE( hull.facets().size() == 6 );
+      Polytope P = hull.makePolytope();
+      REQUIRE( P.count() == 125 );
+      REQUIRE( P.canBeSummed() );
+    }
+  }
+  GIVEN( "A simplex and some points inside" ) {
+    std::vector<Point> simplex = { Point( 0, 0, 0 ), Point( 7, 1, 2 ),
+                                   Point( 2, 9, -1 ), Point( 1, 3, 8 ) };
+    Polytope S = Convexity::makeSimplex( simplex.begin(), simplex.end() );
+    std::vector<Point> points;
+    S.getPoints( points );
+    std::random_shuffle( points.begin(), points.end() );
+    THEN( "The hull is the simplex" ) {
+      REQUIRE( hull.compute( points.begin(), points.end(), 8 ) == 3 );
+      REQUIRE( checkPolyhedron( hull, points ) );
+      REQUIRE( hull.facets().size() == 4 );
+      REQUIRE( hull.vertices().size() == 4 );
+      Polytope P = hull.makePolytope();
+      REQUIRE( P.count() == S.count() );
+      REQUIRE( P.canBeSummed() );
+    }
+    THEN( "Its Minkowski sums with cells are those of the simplex" ) {
+      hull.compute( points.begin(), points.end() );
+      Polytope P = hull.makePolytope();
+      Polytope P1 = P + Polytope::UnitCell( { 0 } );
+      Polytope S1 = S + Polytope::UnitCell( { 0 } );
+      REQUIRE( P1.count() == S1.count() );
+      Polytope P3 = P + Polytope::UnitCell( { 0, 1, 2 } );
+      Polytope S3 = S + Polytope::UnitCell( { 0, 1, 2 } );
+      REQUIRE( P3.count() == S3.count() );
+      Polytope P2 = P + Polytope::UnitCell( { 1, 2 } );
+      Polytope S2 = S + Polytope::UnitCell( { 1, 2 } );
+      REQUIRE( P2.count() == S2.count() );
+    }
+    THEN( "DigitalConvexity::makePolytope gives the same polytope" ) {
+      Polytope P = Convexity::makePolytope( points.begin(), points.end() );
+      REQUIRE( P.count() == S.count() );
+      Convexity dconv( Point( -2, -2, -3 ), Point( 10, 12, 10 ) );
+      REQUIRE( dconv.isFullyConvex( P ) == dconv.isFullyConvex( S ) );
+    }
+  }
+  GIVEN( "Random points in a ball" ) {
+    srand( 0 );
+    std::vector<Point> points = randomPointsInBall<Point>( 5000, 20 );
+    THEN( "The hull is valid, and does not depend on chunks" ) {
+      REQUIRE( hull.compute( points.begin(), points.end() ) == 3 );
+      REQUIRE( checkPolyhedron( hull, points ) );
+      QuickHull hull2;
+      hull2.compute( points.begin(), points.end(), 100 );
+      REQUIRE( checkPolyhedron( hull2, points ) );
+      REQUIRE( facetSet( hull ) == facetSet( hull2 ) );
+      Polytope P1 = hull.makePolytope();
+      Polytope P2 = hull2.makePolytope();
+      REQUIRE( P1.count() == P2.count() );
+      for ( auto&& p : points ) REQUIRE( P1.isInside( p ) );
+    }
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
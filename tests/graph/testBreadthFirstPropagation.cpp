@@ -36,6 +36,7 @@
 #include "DGtal/graph/CUndirectedSimpleGraph.h"
 #include "DGtal/graph/BreadthFirstVisitor.h"
 #include "DGtal/graph/CGraphVisitor.h"
+#include "DGtal/graph/DomainMarkSet.h"
 #include <set>
 #include <iterator>
 ///////////////////////////////////////////////////////////////////////////////
@@ -136,10 +137,73 @@ void testBreadthFirstPropagation()
   board.saveEPS("testBreadthFirstPropagation.eps");
 }
 
+bool testBreadthFirstPropagationWithDomainMarkSet()
+{
+  typedef Z2i::Point Point;
+  typedef Z2i::Domain Domain;
+  typedef Z2i::DigitalSet DigitalSet;
+  typedef Z2i::Object4_8 Object;
+  typedef DomainMarkSet<Domain> MarkSet;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock( "Breadth first propagation with caller-provided marks" );
+  Domain domain( Point( -41, -36 ), Point( 18, 18 ) );
+  Point c1( -2, -1 );
+  DigitalSet shape_set( domain );
+  Shapes<Domain>::addNorm2Ball( shape_set, c1, 9 );
+  Shapes<Domain>::addNorm1Ball( shape_set, Point( -14, 5 ), 9 );
+  Shapes<Domain>::addNorm1Ball( shape_set, Point( -30, -15 ), 10 );
+  Shapes<Domain>::addNorm2Ball( shape_set, Point( -10, -20 ), 12 );
+  Object obj( Z2i::dt4_8, shape_set );
+
+  // Visits with the default marks and with marks on caller bits.
+  std::vector< std::pair< Point, Object::Size > > nodes, nodes_bits;
+  BreadthFirstVisitor<Object, set<Point> > bfv( obj, c1 );
+  for ( ; ! bfv.finished(); bfv.expand() )
+    nodes.push_back( bfv.current() );
+  boost::dynamic_bitset<> bits;
+  {
+    BreadthFirstVisitor<Object, MarkSet> bfv_bits( obj, &c1, &c1 + 1,
+                                                   MarkSet( domain, bits ) );
+    ++nb; nbok += bfv_bits.markedVertices().isAliasing() ? 1 : 0;
+    for ( ; ! bfv_bits.finished(); bfv_bits.expand() )
+      nodes_bits.push_back( bfv_bits.current() );
+  }
+  ++nb; nbok += ( nodes == nodes_bits ) ? 1 : 0;
+  ++nb; nbok += ( bits.count() == nodes.size() ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nodes.size() << " vertices visited, "
+               << bits.count() << " marked bits." << std::endl;
+
+  // Pre-marked vertices are never visited: a wall x=-6 splits the object.
+  bits.reset();
+  MarkSet wall( domain, bits );
+  for ( Point p = Point( -6, domain.lowerBound()[ 1 ] );
+        p[ 1 ] <= domain.upperBound()[ 1 ]; ++p[ 1 ] )
+    wall.insert( p );
+  Object::Size nbWall = (Object::Size) wall.size();
+  BreadthFirstVisitor<Object, MarkSet> bfv_wall( obj, &c1, &c1 + 1,
+                                                 std::move( wall ) );
+  unsigned int nbLeft = 0;
+  for ( ; ! bfv_wall.finished(); bfv_wall.expand() )
+    nbLeft += ( bfv_wall.current().first[ 0 ] < -6 ) ? 1 : 0;
+  ++nb; nbok += ( nbLeft == 0 ) ? 1 : 0;
+  ++nb; nbok += ( bits.count() > nbWall && bits.count() < nbWall + nodes.size() ) ? 1 : 0;
+  MarkSet copy( bfv_wall.markedVertices() );
+  copy.clear();
+  ++nb; nbok += ( ! copy.isAliasing() && bits.count() > nbWall ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "wall of " << nbWall << " points." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 int main( int /*argc*/, char** /*argv*/ )
 {
   testBreadthFirstPropagation();
-  return 0;
+  bool res = testBreadthFirstPropagationWithDomainMarkSet();
+  return res ? 0 : 1;
 }
 
 
@@ -37,6 +37,7 @@
 #include "DGtal/graph/CGraphVisitor.h"
 #include "DGtal/graph/GraphVisitorRange.h"
 #include "DGtal/graph/DistanceBreadthFirstVisitor.h"
+#include "DGtal/graph/DomainMarkSet.h"
 #include "DGtal/geometry/volumes/distance/LpMetric.h"
 #include "DGtal/io/boards/Board2D.h"
 #include "DGtal/io/Color.h"
@@ -170,9 +171,73 @@ bool testDistancePropagation()
   return nb == nbok;
 }
 
+bool testLevelSynchronousDistancePropagation()
+{
+  typedef Z2i::Space Space;
+  typedef Z2i::Point Point;
+  typedef Z2i::Domain Domain;
+  typedef Z2i::DigitalSet DigitalSet;
+  typedef Z2i::Object8_4 Object;
+  typedef DomainMarkSet<Domain> MarkSet;
+  typedef CanonicEmbedder<Space> VertexEmbedder;
+  typedef VertexEmbedder::Value RealPoint;
+  typedef RealPoint::Coordinate Scalar;
+  typedef LpMetric<Space> Distance;
+  using DistanceToPoint = std::function<double(const Space::RealPoint &)>;
+  typedef DGtal::functors::Composer<VertexEmbedder, DistanceToPoint, Scalar> VertexFunctor;
+  typedef DistanceBreadthFirstVisitor< Object, VertexFunctor, std::set<Point> > Visitor;
+  typedef DistanceBreadthFirstVisitor< Object, VertexFunctor, MarkSet > BitsVisitor;
+  typedef std::pair<Point, Scalar> Pair;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock( "Level-synchronous distance propagation" );
+  Domain domain( Point( -41, -36 ), Point( 18, 18 ) );
+  Point c1( -2, -1 );
+  DigitalSet shape_set( domain );
+  Shapes<Domain>::addNorm2Ball( shape_set, c1, 9 );
+  Shapes<Domain>::addNorm1Ball( shape_set, Point( -14, 5 ), 9 );
+  Shapes<Domain>::addNorm1Ball( shape_set, Point( -30, -15 ), 10 );
+  Shapes<Domain>::addNorm2Ball( shape_set, Point( -10, -20 ), 12 );
+  Object obj( Z2i::dt8_4, shape_set );
+
+  VertexEmbedder embedder;
+  Distance distance( 1.0 );
+  DistanceToPoint distanceToPoint = std::bind( distance, embedder( c1 ), std::placeholders::_1 );
+  VertexFunctor vfunctor( embedder, distanceToPoint );
+
+  // Layers are compared as sets of (vertex,distance).
+  std::vector< std::set<Pair> > layers, layers_par;
+  std::vector< typename Visitor::Node > layer;
+  Visitor visitor( obj, vfunctor, c1 );
+  while ( ! visitor.finished() )
+    {
+      visitor.getCurrentLayer( layer );
+      layers.push_back( std::set<Pair>( layer.begin(), layer.end() ) );
+      visitor.expandLayer();
+    }
+  boost::dynamic_bitset<> bits;
+  BitsVisitor visitor_par( obj, vfunctor, &c1, &c1 + 1, MarkSet( domain, bits ) );
+  std::vector< typename BitsVisitor::Node > layer_par;
+  while ( ! visitor_par.finished() )
+    {
+      visitor_par.getCurrentLayer( layer_par );
+      layers_par.push_back( std::set<Pair>( layer_par.begin(), layer_par.end() ) );
+      visitor_par.expandLayerInParallel();
+    }
+  ++nb; nbok += ( layers.size() > 1 && layers == layers_par ) ? 1 : 0;
+  ++nb; nbok += ( bits.count() == shape_set.size() ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << layers.size() << " layers, " << bits.count()
+               << " marked vertices." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 int main( int /*argc*/, char** /*argv*/ )
 {
-  bool res = testDistancePropagation();
+  bool res = testDistancePropagation()
+    && testLevelSynchronousDistancePropagation();
   return res ? 0 : 1;
 }
 
@@ -0,0 +1,169 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMultiSourceGeodesics.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class MultiSourceGeodesics.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <queue>
+#include <vector>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+#include "DGtal/graph/MultiSourceGeodesics.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/CompressedSurfelGraph.h"
+#include "DGtal/topology/CanonicSCellEmbedder.h"
+#include "DGtal/shapes/Shapes.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+typedef CompressedSurfelGraph< KSpace >      Graph;
+typedef MultiSourceGeodesics< Graph >        Geodesics;
+typedef CanonicSCellEmbedder< KSpace >       Embedder;
+
+/// Reference Dijkstra with a binary heap.
+static std::vector<double>
+referenceDistances( const Graph & graph, const Embedder & embedder,
+                    Graph::Vertex source )
+{
+  typedef std::pair<double, Graph::Vertex> Item;
+  std::vector<double> d( graph.size(), Geodesics::infinity() );
+  std::priority_queue< Item, std::vector<Item>, std::greater<Item> > q;
+  d[ source ] = 0.0;
+  q.push( Item( 0.0, source ) );
+  while ( ! q.empty() )
+    {
+      Item item = q.top(); q.pop();
+      if ( item.first > d[ item.second ] ) continue;
+      for ( auto it = graph.neighborsBegin( item.second ),
+              itE = graph.neighborsEnd( item.second ); it != itE; ++it )
+        {
+          double du = item.first + ( embedder( graph.surfel( *it ) )
+                                     - embedder( graph.surfel( item.second ) ) ).norm();
+          if ( du < d[ *it ] ) { d[ *it ] = du; q.push( Item( du, *it ) ); }
+        }
+    }
+  return d;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class MultiSourceGeodesics.
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "MultiSourceGeodesics on the boundary of a digital set", "[geodesics]" )
+{
+  typedef DigitalSetBoundary< KSpace, DigitalSet > Container;
+  Point p1( -9, -9, -9 );
+  Point p2(  9,  9,  9 );
+  KSpace K;
+  K.init( p1, p2, true );
+  DigitalSet aSet( Domain( p1, p2 ) );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( -2, 0, 0 ), 5 );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( 3, 1, 0 ), 4 );
+  Container container( K, aSet );
+  Graph graph( container );
+  Embedder embedder( K );
+  Geodesics geodesics( graph );
+  const std::vector<Graph::Vertex> sources = { 0, graph.size() / 3, graph.size() / 2, graph.size() - 1 };
+  auto close = [] ( double a, double b ) { return std::fabs( a - b ) <= 1e-9 * ( 1.0 + b ); };
+
+  GIVEN( "Unit weights" ) {
+    THEN( "Distances are the topological distances of a breadth-first traversal" ) {
+      REQUIRE( geodesics.minWeight() == 1.0 );
+      std::vector<double> d;
+      geodesics.distances( sources[ 1 ], d );
+      BreadthFirstVisitor< Graph > bfv( graph, sources[ 1 ] );
+      std::size_t nb = 0, nbok = 0;
+      for ( ; ! bfv.finished(); bfv.expand(), ++nb )
+        nbok += ( d[ bfv.current().first ] == (double) bfv.current().second ) ? 1 : 0;
+      REQUIRE( nb == graph.size() );
+      REQUIRE( nbok == nb );
+    }
+  }
+  GIVEN( "Euclidean weights between surfel centers" ) {
+    geodesics.setEuclideanWeights( [&] ( Graph::Vertex v )
+                                   { return embedder( graph.surfel( v ) ); } );
+    std::vector< std::vector<double> > refs;
+    for ( auto s : sources ) refs.push_back( referenceDistances( graph, embedder, s ) );
+    THEN( "Weights are 1 or sqrt(2)/2" ) {
+      REQUIRE( close( geodesics.minWeight(), std::sqrt( 2.0 ) / 2.0 ) );
+      REQUIRE( close( geodesics.maxWeight(), 1.0 ) );
+    }
+    THEN( "Single source distances are the ones of Dijkstra with a heap" ) {
+      std::size_t nbok = 0;
+      for ( std::size_t i = 0; i < sources.size(); ++i )
+        {
+          std::vector<double> d;
+          geodesics.distances( sources[ i ], d );
+          for ( Graph::Vertex v = 0; v < graph.size(); ++v )
+            nbok += close( d[ v ], refs[ i ][ v ] ) ? 1 : 0;
+        }
+      REQUIRE( nbok == sources.size() * graph.size() );
+    }
+    THEN( "Nearest sources give the smallest distance to the sources" ) {
+      std::vector<double> d;
+      std::vector<Geodesics::Index> labels;
+      geodesics.nearestSources( sources, d, labels );
+      std::size_t nbok = 0;
+      for ( Graph::Vertex v = 0; v < graph.size(); ++v )
+        {
+          double m = Geodesics::infinity();
+          for ( std::size_t i = 0; i < sources.size(); ++i ) m = std::min( m, refs[ i ][ v ] );
+          nbok += ( labels[ v ] < sources.size() && close( d[ v ], m )
+                    && close( refs[ labels[ v ] ][ v ], m ) ) ? 1 : 0;
+        }
+      REQUIRE( nbok == graph.size() );
+      for ( std::size_t i = 0; i < sources.size(); ++i )
+        REQUIRE( labels[ sources[ i ] ] == i );
+    }
+    THEN( "The distance matrix rows are the single source distances" ) {
+      std::vector<Graph::Vertex> targets;
+      for ( Graph::Vertex v = 0; v < graph.size(); v += 7 ) targets.push_back( v );
+      std::vector<double> matrix;
+      geodesics.distanceMatrix( sources, targets, matrix );
+      REQUIRE( matrix.size() == sources.size() * targets.size() );
+      std::size_t nbok = 0;
+      for ( std::size_t i = 0; i < sources.size(); ++i )
+        for ( std::size_t j = 0; j < targets.size(); ++j )
+          nbok += close( matrix[ i * targets.size() + j ], refs[ i ][ targets[ j ] ] ) ? 1 : 0;
+      REQUIRE( nbok == matrix.size() );
+      std::vector<double> square;
+      geodesics.distanceMatrix( sources, sources, square );
+      for ( std::size_t i = 0; i < sources.size(); ++i )
+        for ( std::size_t j = 0; j < sources.size(); ++j )
+          REQUIRE( close( square[ i * sources.size() + j ], square[ j * sources.size() + i ] ) );
+    }
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
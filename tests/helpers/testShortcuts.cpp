@@ -29,6 +29,7 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/Shortcuts.h"
 #include "DGtalCatch.h"
@@ -82,5 +83,59 @@ SCENARIO( "Shortcuts< K3 > pointel ordering", "[shortcuts][pointel]" )
   }
 }
 
+SCENARIO( "Shortcuts< K3 > all surface components", "[shortcuts][components]" )
+{
+  typedef KhalimskySpaceND<3>                       KSpace;
+  typedef Shortcuts< KSpace >                       SH3;
+  typedef SH3::Point                                Point;
+  typedef SH3::Domain                               Domain;
+
+  auto params          = SH3::defaultParameters();
+  params( "surfaceComponents", "All" );
+  Domain domain( Point( -10, -10, -10 ), Point( 10, 10, 10 ) );
+  CountedPtr<SH3::BinaryImage> binary_image( new SH3::BinaryImage( domain ) );
+  // Two balls, a hollow ball and one isolated voxel: 5 components.
+  for ( auto p : domain )
+    {
+      const auto r1 = ( p - Point( -5, -5, -5 ) ).squaredNorm();
+      const auto r2 = ( p - Point(  5,  5, -5 ) ).squaredNorm();
+      const auto r3 = ( p - Point(  2, -3,  5 ) ).squaredNorm();
+      binary_image->setValue( p, ( r1 <= 9 ) || ( r2 <= 4 )
+                              || ( ( r3 <= 16 ) && ( r3 > 4 ) )
+                              || ( p == Point( 8, -8, 8 ) ) );
+    }
+  KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+
+  GIVEN( "A binary image with several connected components" ) {
+    SH3::SurfelRange surfel_reps;
+    SH3::IdxRange    nb_surfels;
+    auto surfaces = SH3::makeLightDigitalSurfaces( surfel_reps, nb_surfels,
+                                                   binary_image, K, params );
+    THEN( "There are 5 surface components, with their representative and size" ) {
+      REQUIRE( surfaces.size() == 5 );
+      REQUIRE( surfel_reps.size() == 5 );
+      REQUIRE( nb_surfels.size() == 5 );
+    }
+    THEN( "Representatives are the smallest surfels of each component, and sizes are exact" ) {
+      std::size_t total = 0;
+      bool ok = true;
+      for ( std::size_t i = 0; i < surfaces.size(); ++i )
+        {
+          std::vector<SH3::Surfel> surfels( surfaces[ i ]->begin(), surfaces[ i ]->end() );
+          ok = ok && ( surfels.size() == nb_surfels[ i ] )
+            && ( *std::min_element( surfels.begin(), surfels.end() ) == surfel_reps[ i ] );
+          total += surfels.size();
+        }
+      REQUIRE( ok );
+      SH3::SurfelSet all_surfels;
+      Surfaces<KSpace>::sMakeBoundary( all_surfels, K, *binary_image,
+                                       K.lowerBound(), K.upperBound() );
+      REQUIRE( total == all_surfels.size() );
+      REQUIRE( std::is_sorted( surfel_reps.begin(), surfel_reps.end() ) );
+    }
+  }
+}
+
 //                                                                           //
 ///////////////////////////////////////////////////////////////////////////////
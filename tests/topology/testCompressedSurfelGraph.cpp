@@ -0,0 +1,129 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testCompressedSurfelGraph.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class CompressedSurfelGraph.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/graph/CUndirectedSimpleGraph.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/CompressedSurfelGraph.h"
+#include "DGtal/shapes/Shapes.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class CompressedSurfelGraph.
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "CompressedSurfelGraph< KSpace > build tests", "[csrgraph][build]" )
+{
+  typedef DigitalSetBoundary< KSpace, DigitalSet > DigitalSurfaceContainer;
+  typedef DigitalSurface< DigitalSurfaceContainer > DigSurface;
+  typedef CompressedSurfelGraph< KSpace >           Graph;
+  Point p1( -5, -5, -5 );
+  Point p2(  5,  5,  5 );
+  KSpace K;
+  K.init( p1, p2, true );
+  DigitalSet aSet( Domain( p1, p2 ) );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( 0, 0, 0 ), 3 );
+  DigitalSurfaceContainer container( K, aSet );
+  DigSurface dsurf( container );
+  Graph graph( container );
+  GIVEN( "A digital set boundary over a ball of radius 3" ) {
+    THEN( "The graph is valid and has 174 vertices with 4 neighbors each" ) {
+      REQUIRE( graph.isValid() );
+      REQUIRE( graph.size() == 174 );
+      REQUIRE( graph.nbArcs() == 4 * 174 );
+      REQUIRE( graph.degree( 0 ) == 4 );
+      REQUIRE( graph.degree( 173 ) == 4 );
+    }
+    THEN( "Vertices are numbered in increasing order of surfels" ) {
+      std::vector<SCell> surfels( dsurf.begin(), dsurf.end() );
+      std::sort( surfels.begin(), surfels.end() );
+      REQUIRE( surfels == graph.surfels() );
+    }
+    THEN( "Index and surfel are inverse mappings" ) {
+      bool ok = true;
+      for ( auto v : graph )
+        ok = ok && ( graph.index( graph.surfel( v ) ) == v );
+      REQUIRE( ok );
+      Graph::Index invalid = Graph::InvalidIndex;
+      REQUIRE( graph.index( K.sCell( Point( 0, 0, 0 ) ) ) == invalid );
+    }
+    THEN( "Neighbors are the ones of the digital surface, in the same order" ) {
+      bool ok = true;
+      for ( auto v : graph )
+        {
+          std::vector<SCell> dneighbors;
+          std::back_insert_iterator< std::vector<SCell> > outIt( dneighbors );
+          dsurf.writeNeighbors( outIt, graph.surfel( v ) );
+          std::vector<SCell> gneighbors;
+          for ( auto it = graph.neighborsBegin( v ), itE = graph.neighborsEnd( v );
+                it != itE; ++it )
+            gneighbors.push_back( graph.surfel( *it ) );
+          ok = ok && ( dneighbors == gneighbors );
+        }
+      REQUIRE( ok );
+    }
+    THEN( "Breadth-first visiting the graph gives the same distances as on the digital surface" ) {
+      const SCell start = graph.surfel( 0 );
+      BreadthFirstVisitor< DigSurface > dvisitor( dsurf, start );
+      BreadthFirstVisitor< Graph >      gvisitor( graph, 0 );
+      std::map<SCell,unsigned int> ddist, gdist;
+      while ( ! dvisitor.finished() )
+        {
+          ddist[ dvisitor.current().first ] = dvisitor.current().second;
+          dvisitor.expand();
+        }
+      while ( ! gvisitor.finished() )
+        {
+          gdist[ graph.surfel( gvisitor.current().first ) ] = gvisitor.current().second;
+          gvisitor.expand();
+        }
+      REQUIRE( gdist.size() == 174 );
+      REQUIRE( ddist == gdist );
+    }
+  }
+}
+
+SCENARIO( "CompressedSurfelGraph< KSpace > concept check tests", "[csrgraph][concepts]" )
+{
+  typedef CompressedSurfelGraph< KSpace > Graph;
+  BOOST_CONCEPT_ASSERT(( concepts::CUndirectedSimpleGraph< Graph > ));
+}
+
+/** @ingroup Tests **/
@@ -36,6 +36,7 @@
 #include "DGtal/topology/KhalimskySpaceND.h"
 #include "DGtal/topology/KhalimskyCellHashFunctions.h"
 #include "DGtal/topology/CubicalComplex.h"
+#include "DGtal/topology/DenseCellMap.h"
 #include "DGtalCatch.h"
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -512,6 +513,117 @@ SCENARIO( "CubicalComplex< K3,std::map<> > collapse tests", "[cubical_complex][c
   }
 }
 
+SCENARIO( "CubicalComplex< K3,std::map<> > incremental collapse tests", "[cubical_complex][collapse]" )
+{
+  typedef KhalimskySpaceND<3>               KSpace;
+  typedef KSpace::Point            Point;
+  typedef KSpace::Cell             Cell;
+  typedef KSpace::Integer          Integer;
+  typedef std::map<Cell, CubicalCellData>   Map;
+  typedef CubicalComplex< KSpace, Map >     CC;
+  typedef DenseCellMap< KSpace >            DenseMap;
+  typedef CubicalComplex< KSpace, DenseMap > DenseCC;
+  typedef CC::CellMapIterator      CellMapIterator;
+
+  KSpace K;
+  K.init( Point( 0,0,0 ), Point( 16,16,16 ), true );
+
+  GIVEN( "A closed cubical complex made of 3x3x3 voxels with their incident cells" ) {
+    CC complex( K );
+    std::vector<Cell> S;
+    for ( Integer x = 0; x < 3; ++x )
+      for ( Integer y = 0; y < 3; ++y )
+        for ( Integer z = 0; z < 3; ++z )
+          {
+            S.push_back( K.uSpel( Point( x, y, z ) ) );
+            complex.insertCell( S.back() );
+          }
+    complex.close();
+    const auto initial_size = complex.size();
+
+    WHEN( "Fixing two vertices of this big cube and collapsing it incrementally" ) {
+      CellMapIterator it1 = complex.findCell( 0, K.uCell( Point( 0, 0, 0 ) ) );
+      CellMapIterator it2 = complex.findCell( 0, K.uCell( Point( 4, 4, 4 ) ) );
+      REQUIRE( it1 != complex.end( 0 ) );
+      REQUIRE( it2 != complex.end( 0 ) );
+      it1->second.data |= CC::FIXED;
+      it2->second.data |= CC::FIXED;
+      CC::DefaultCellMapIteratorPriority P;
+      functions::CollapseStatistics stats;
+      auto nb_removed = functions::incrementalCollapse( complex, S.begin(), S.end(),
+                                                        P, stats, false, true );
+      CAPTURE( stats.nbCollapsible );
+      CAPTURE( stats.nbPushed );
+      CAPTURE( stats.nbExamined );
+
+      THEN( "It keeps its topology so its euler characteristic is 1" ) {
+       REQUIRE( complex.euler() == 1 );
+      } AND_THEN( "It has no more 2-cells and 3-cells" ) {
+        REQUIRE( complex.nbCells( 2 ) == 0 );
+        REQUIRE( complex.nbCells( 3 ) == 0 );
+      } AND_THEN( "The fixed vertices are still there" ) {
+        REQUIRE( complex.belongs( K.uCell( Point( 0, 0, 0 ) ) ) );
+        REQUIRE( complex.belongs( K.uCell( Point( 4, 4, 4 ) ) ) );
+      } AND_THEN( "Statistics are consistent" ) {
+        REQUIRE( nb_removed == initial_size - complex.size() );
+        REQUIRE( stats.nbRemoved == nb_removed );
+        REQUIRE( stats.nbRemoved == 2 * stats.nbPairs );
+        REQUIRE( stats.nbCollapsible == initial_size - 2 );
+        REQUIRE( stats.nbExamined == stats.nbPushed );
+        REQUIRE( stats.nbPairs <= stats.nbExamined );
+      }
+    }
+  }
+
+  GIVEN( "The closed boundary of a 5x5x5 cube made of voxels" ) {
+    CC complex( K );
+    CC ref_complex( K );
+    DenseCC dense_complex( K );
+    std::vector<Cell> S;
+    for ( Integer x = 0; x < 5; ++x )
+      for ( Integer y = 0; y < 5; ++y )
+        for ( Integer z = 0; z < 5; ++z )
+          if ( x == 0 || x == 4 || y == 0 || y == 4 || z == 0 || z == 4 )
+            {
+              S.push_back( K.uSpel( Point( x, y, z ) ) );
+              complex.insertCell( S.back() );
+              ref_complex.insertCell( S.back() );
+              dense_complex.insertCell( S.back() );
+            }
+    complex.close();
+    ref_complex.close();
+    dense_complex.close();
+    REQUIRE( complex.euler() == 2 );
+
+    WHEN( "Collapsing it with collapse and incrementalCollapse" ) {
+      CC::DefaultCellMapIteratorPriority P;
+      DenseCC::DefaultCellMapIteratorPriority DP;
+      functions::CollapseStatistics stats, dense_stats;
+      functions::incrementalCollapse( complex, S.begin(), S.end(), P, stats, false, true );
+      functions::incrementalCollapse( dense_complex, S.begin(), S.end(), DP, dense_stats, false, true );
+      functions::collapse( ref_complex, S.begin(), S.end(), P, false, true );
+      THEN( "It keeps its topology so its euler characteristic is 2" ) {
+        REQUIRE( complex.euler() == 2 );
+        REQUIRE( ref_complex.euler() == 2 );
+        REQUIRE( complex.nbCells( 3 ) == 0 );
+        REQUIRE( complex.nbCells( 2 ) > 0 );
+      } AND_THEN( "The result is closed" ) {
+        CC closure = complex;
+        closure.close();
+        REQUIRE( closure.size() == complex.size() );
+      } AND_THEN( "The result does not depend on the cell container" ) {
+        REQUIRE( dense_stats.nbPairs == stats.nbPairs );
+        REQUIRE( dense_stats.nbExamined == stats.nbExamined );
+        for ( Dimension d = 0; d <= 3; ++d )
+          REQUIRE( dense_complex.nbCells( d ) == complex.nbCells( d ) );
+        unsigned int nb_ok = 0;
+        for ( auto c : dense_complex ) nb_ok += complex.belongs( c ) ? 1 : 0;
+        REQUIRE( nb_ok == complex.size() );
+      }
+    }
+  }
+}
+
 SCENARIO( "CubicalComplex< K3,std::map<> > link tests", "[cubical_complex][link]" )
 {
   typedef KhalimskySpaceND<3>               KSpace;
@@ -618,5 +730,156 @@ SCENARIO( "CubicalComplex< K2,std::map<> > set operations and relations", "[cubi
   bool X1bd_equal_X1boundary = X1bd == X1.boundary();
   REQUIRE( X1bd_equal_X1boundary );
 }
+SCENARIO( "CubicalComplex< K3,DenseCellMap<> > unit tests (incidence,...)", "[cubical_complex][incidence][dense]" )
+{
+  typedef KhalimskySpaceND<3>                       KSpace;
+  typedef KSpace::Point                             Point;
+  typedef KSpace::Cell                              Cell;
+  typedef DenseCellMap< KSpace >                    DenseMap;
+  typedef std::map<Cell, CubicalCellData>           Map;
+  typedef CubicalComplex< KSpace, DenseMap >        CC;
+  typedef CubicalComplex< KSpace, Map >             RefCC;
+  typedef CC::CellMapConstIterator                  CellMapConstIterator;
+
+  BOOST_CONCEPT_ASSERT(( concepts::CSTLAssociativeContainer< DenseMap > ));
+  srand( 0 );
+  KSpace K;
+  K.init( Point( -5,0,0 ), Point( 60,63,40 ), true );
+
+  GIVEN( "A cubical complex with random 3-cells and the same complex with std::map<>" ) {
+    CC    complex( K );
+    RefCC ref_complex( K );
+    for ( int n = 0; n < NBCELLS; ++n )
+      {
+        Point p( (rand() % 64) * 2 - 9, (rand() % 64) | 0x1, (rand() % 40) | 0x1 );
+        Cell cell = K.uCell( p );
+        complex.insertCell( cell );
+        ref_complex.insertCell( cell );
+      }
+    complex.close();
+    ref_complex.close();
+    THEN( "They have the same number of cells in each dimension" ) {
+      for ( Dimension d = 0; d <= 3; ++d )
+        REQUIRE( complex.nbCells( d ) == ref_complex.nbCells( d ) );
+      REQUIRE( complex.euler() == ref_complex.euler() );
+    }
+    THEN( "They have the same cells, with the same faces and co-faces" ) {
+      unsigned int nb_ok = 0;
+      for ( Dimension d = 0; d <= 3; ++d )
+        for ( CellMapConstIterator it = complex.begin( d ), itE = complex.end( d );
+              it != itE; ++it )
+          {
+            std::vector<Cell> faces, ref_faces;
+            std::back_insert_iterator< std::vector<Cell> > outIt( faces );
+            std::back_insert_iterator< std::vector<Cell> > refOutIt( ref_faces );
+            complex.directCoFaces( outIt, it->first );
+            complex.directFaces( outIt, it->first );
+            ref_complex.directCoFaces( refOutIt, it->first );
+            ref_complex.directFaces( refOutIt, it->first );
+            if ( ref_complex.belongs( it->first ) && faces == ref_faces ) ++nb_ok;
+          }
+      REQUIRE( nb_ok == ref_complex.size() );
+    }
+    WHEN( "Erasing all 3-cells through iterators" ) {
+      complex.eraseCells( complex.begin( 3 ), complex.end( 3 ) );
+      THEN( "There are no more 3-cells" ) {
+        REQUIRE( complex.nbCells( 3 ) == 0 );
+        REQUIRE( complex.begin( 3 ) == complex.end( 3 ) );
+        REQUIRE( complex.nbCells( 2 ) == ref_complex.nbCells( 2 ) );
+      }
+    }
+  }
+}
+
+SCENARIO( "CubicalComplex< K3,DenseCellMap<> > collapse tests", "[cubical_complex][collapse][dense]" )
+{
+  typedef KhalimskySpaceND<3>                       KSpace;
+  typedef KSpace::Point                             Point;
+  typedef KSpace::Cell                              Cell;
+  typedef KSpace::Integer                           Integer;
+  typedef DenseCellMap< KSpace >                    Map;
+  typedef CubicalComplex< KSpace, Map >             CC;
+  typedef CC::CellMapIterator                       CellMapIterator;
+
+  KSpace K;
+  K.init( Point( 0,0,0 ), Point( 8,8,8 ), true );
+
+  GIVEN( "A closed cubical complex made of 3x3x3 voxels with their incident cells" ) {
+    CC complex( K );
+    std::vector<Cell> S;
+    for ( Integer x = 0; x < 3; ++x )
+      for ( Integer y = 0; y < 3; ++y )
+        for ( Integer z = 0; z < 3; ++z )
+          {
+            S.push_back( K.uSpel( Point( x, y, z ) ) );
+            complex.insertCell( S.back() );
+          }
+    complex.close();
+
+    THEN( "It has Euler characteristic 1" ) {
+      REQUIRE( complex.euler() == 1 );
+    }
+
+    WHEN( "Fixing two vertices of this big cube and collapsing it" ) {
+      CellMapIterator it1 = complex.findCell( 0, K.uCell( Point( 0, 0, 0 ) ) );
+      CellMapIterator it2 = complex.findCell( 0, K.uCell( Point( 6, 6, 6 ) ) );
+      REQUIRE( it1 != complex.end( 0 ) );
+      REQUIRE( it2 != complex.end( 0 ) );
+      it1->second.data |= CC::FIXED;
+      it2->second.data |= CC::FIXED;
+      CC::DefaultCellMapIteratorPriority P;
+      functions::collapse( complex, S.begin(), S.end(), P, false, true );
+
+      THEN( "It keeps its topology so its euler characteristic is 1" ) {
+       REQUIRE( complex.euler() == 1 );
+      } AND_THEN( "It has no more 2-cells and 3-cells" ) {
+        REQUIRE( complex.nbCells( 2 ) == 0 );
+        REQUIRE( complex.nbCells( 3 ) == 0 );
+      } AND_THEN( "The fixed vertices are still there" ) {
+        REQUIRE( complex.belongs( K.uCell( Point( 0, 0, 0 ) ) ) );
+        REQUIRE( complex.belongs( K.uCell( Point( 6, 6, 6 ) ) ) );
+      }
+    }
+  }
+}
+
+SCENARIO( "CubicalComplex< K2,DenseCellMap<> > set operations and relations", "[cubical_complex][ccops][dense]" )
+{
+  typedef KhalimskySpaceND<2>               KSpace;
+  typedef KSpace::Point                     Point;
+  typedef DenseCellMap< KSpace >            Map;
+  typedef CubicalComplex< KSpace, Map >     CC;
+
+  KSpace K;
+  K.init( Point( 0,0 ), Point( 5,3 ), true );
+  CC X1( K );
+  X1.insertCell( K.uSpel( Point(1,1) ) );
+  X1.insertCell( K.uSpel( Point(2,1) ) );
+  X1.insertCell( K.uSpel( Point(3,1) ) );
+  X1.insertCell( K.uSpel( Point(2,2) ) );
+  CC X1c = ~ X1;
+
+  CC X2( K );
+  X2.insertCell( K.uSpel( Point(2,2) ) );
+  X2.insertCell( K.uSpel( Point(3,2) ) );
+  X2.insertCell( K.uSpel( Point(4,2) ) );
+  X2.close();
+  CC X2c = ~ X2;
+  REQUIRE( ( X1 & X2 ).size() < X1.size() );
+  bool X1_and_X2_included_in_X1 = ( X1 & X2 ) <= X1;
+  bool X1c_and_X2c_included_in_X1c = ( X1c & X2c ) <= X1c;
+  CC A = ~( X1 & X2 );
+  CC B = ~( *(X1c & X2c) );
+  bool cl_X1_and_X2_equal_to_X1c_and_X2c = A == B;
+
+  REQUIRE( X1_and_X2_included_in_X1 );
+  REQUIRE( X1c_and_X2c_included_in_X1c );
+  REQUIRE( cl_X1_and_X2_equal_to_X1c_and_X2c );
+
+  CC X1bd = X1c - *X1c;
+  bool X1bd_equal_X1boundary = X1bd == X1.boundary();
+  REQUIRE( X1bd_equal_X1boundary );
+  REQUIRE( ( X1 | X2 ).size() + ( X1 & X2 ).size() == X1.size() + X2.size() );
+}
 //                                                                           //
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,141 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testCubicalComplexCollapse-benchmark.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Benchmark of functions::collapse and functions::incrementalCollapse
+ * on a thick spherical shell within a N^3 box (N=256 by default, or
+ * given as first argument).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
+#include "DGtal/topology/CubicalComplex.h"
+#include "DGtal/topology/CubicalComplexFunctions.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef KhalimskySpaceND<3>                      KSpace;
+typedef KSpace::Point                            Point;
+typedef KSpace::Cell                             Cell;
+typedef KSpace::Integer                          Integer;
+typedef std::unordered_map<Cell, CubicalCellData> Map;
+typedef CubicalComplex< KSpace, Map >            CC;
+
+/// Builds the closed complex of a spherical shell of thickness 4
+/// centered in the box [0,N-1]^3, and returns its voxels in \a S.
+void makeShell( CC& complex, std::vector<Cell>& S, Integer N )
+{
+  const KSpace& K  = complex.space();
+  const double c   = 0.5 * (double) ( N - 1 );
+  const double r2  = 0.25 * (double) ( N - 2 ) * (double) ( N - 2 );
+  const double ri2 = 0.25 * (double) ( N - 10 ) * (double) ( N - 10 );
+  for ( Integer x = 0; x < N; ++x )
+    for ( Integer y = 0; y < N; ++y )
+      for ( Integer z = 0; z < N; ++z )
+        {
+          const double d2 = ( x - c ) * ( x - c ) + ( y - c ) * ( y - c )
+            + ( z - c ) * ( z - c );
+          if ( d2 <= r2 && d2 > ri2 )
+            {
+              S.push_back( K.uSpel( Point( x, y, z ) ) );
+              complex.insertCell( S.back() );
+            }
+        }
+  complex.close();
+}
+
+/// Collapses the shell with the given method and outputs timings.
+template <typename CollapseFunction>
+bool benchmarkCollapse( const std::string& name, const KSpace& K,
+                        Integer N, CollapseFunction collapse )
+{
+  CC complex( K );
+  std::vector<Cell> S;
+  trace.beginBlock( "Building shell for " + name );
+  makeShell( complex, S, N );
+  trace.info() << complex << std::endl;
+  trace.endBlock();
+
+  const auto nb_cells = complex.size();
+  trace.beginBlock( name );
+  Clock c;
+  c.startClock();
+  uint64_t nb_removed = collapse( complex, S );
+  double t = c.stopClock();
+  trace.info() << complex << std::endl;
+  trace.info() << "removed=" << nb_removed << " cells, "
+               << ( t > 0.0 ? ( 1000.0 * (double) nb_cells / t ) : 0.0 )
+               << " cells/s" << std::endl;
+  trace.endBlock();
+  return complex.euler() == 2 && complex.nbCells( 3 ) == 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmark of CubicalComplex collapses" );
+  const Integer N = argc > 1 ? atoi( argv[ 1 ] ) : 256;
+  trace.info() << "N=" << N << std::endl;
+  KSpace K;
+  K.init( Point::diagonal( -1 ), Point::diagonal( N ), true );
+
+  bool res = benchmarkCollapse
+    ( "functions::collapse", K, N,
+      [] ( CC& complex, const std::vector<Cell>& S ) -> uint64_t
+      {
+        CC::DefaultCellMapIteratorPriority P;
+        return functions::collapse( complex, S.begin(), S.end(), P, false, true );
+      } );
+  res = res && benchmarkCollapse
+    ( "functions::incrementalCollapse", K, N,
+      [] ( CC& complex, const std::vector<Cell>& S ) -> uint64_t
+      {
+        CC::DefaultCellMapIteratorPriority P;
+        functions::CollapseStatistics stats;
+        uint64_t nb = functions::incrementalCollapse( complex, S.begin(), S.end(),
+                                                      P, stats, false, true );
+        trace.info() << "collapsible=" << stats.nbCollapsible
+                     << " pushed=" << stats.nbPushed
+                     << " examined=" << stats.nbExamined
+                     << " pairs=" << stats.nbPairs << std::endl;
+        return nb;
+      } );
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,161 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testKhalimskyCellPacker.cpp
+ * @ingroup Tests
+ * @author DGtal team (\c dgtal@liris.cnrs.fr )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class KhalimskyCellPacker3D.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/KhalimskyCellPacker.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/shapes/Shapes.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class KhalimskyCellPacker3D.
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "KhalimskyCellPacker3D< KSpace > services", "[packer][cells]" )
+{
+  typedef KhalimskyCellPacker3D< KSpace > Packer;
+  typedef Packer::PackedSCell             PackedSCell;
+  typedef Packer::PackedCell              PackedCell;
+  KSpace K;
+  K.init( Point( -7, -3, -11 ), Point( 6, 9, 4 ), true );
+  Packer P( K );
+  REQUIRE( P.isValid() );
+
+  // All signed cells of a sub-box, not touching the bounds of K.
+  std::vector< SCell > cells;
+  for ( int z = -19; z <= 5; z += 3 )
+    for ( int y = -3; y <= 17; ++y )
+      for ( int x = -11; x <= 10; ++x )
+        {
+          cells.push_back( K.sCell( Point( x, y, z ), K.POS ) );
+          cells.push_back( K.sCell( Point( x, y, z ), K.NEG ) );
+        }
+
+  GIVEN( "Signed cells of a 3D space" ) {
+    THEN( "Packing then unpacking gives back the same cells" ) {
+      unsigned int nb = 0;
+      for ( auto c : cells )
+        nb += ( P.unpack( P.pack( c ) ) == c ) ? 1 : 0;
+      REQUIRE( nb == cells.size() );
+    }
+    THEN( "Packed cells are valid unsigned cells too" ) {
+      unsigned int nb = 0;
+      for ( auto c : cells )
+        {
+          const Cell uc = K.unsigns( c );
+          const PackedCell pc = P.pack( uc );
+          nb += ( P.unpack( pc ) == uc && Packer::unsigns( P.pack( c ) ) == pc
+                  && Packer::signs( pc, K.sSign( c ) ) == P.pack( c ) ) ? 1 : 0;
+        }
+      REQUIRE( nb == cells.size() );
+    }
+    THEN( "Dimension, directions, signs and orientations are those of KSpace" ) {
+      unsigned int nb = 0;
+      for ( auto c : cells )
+        {
+          const PackedSCell pc = P.pack( c );
+          bool ok = Packer::sDim( pc ) == K.sDim( c )
+            && Packer::sSign( pc ) == K.sSign( c )
+            && P.unpack( Packer::sOpp( pc ) ) == K.sOpp( c );
+          for ( Dimension k = 0; k < 3; ++k )
+            ok = ok && Packer::sIsOpen( pc, k ) == K.sIsOpen( c, k )
+              && Packer::sDirect( pc, k ) == K.sDirect( c, k )
+              && P.sKCoord( pc, k ) == K.sKCoord( c, k );
+          nb += ok ? 1 : 0;
+        }
+      REQUIRE( nb == cells.size() );
+    }
+    THEN( "Incident and adjacent cells are those of KSpace" ) {
+      unsigned int nb = 0;
+      for ( auto c : cells )
+        {
+          const PackedSCell pc = P.pack( c );
+          const PackedCell  uc = Packer::unsigns( pc );
+          bool ok = true;
+          for ( Dimension k = 0; k < 3; ++k )
+            for ( int up = 0; up < 2; ++up )
+              ok = ok
+                && P.unpack( Packer::sIncident( pc, k, up ) ) == K.sIncident( c, k, up )
+                && P.unpack( Packer::sAdjacent( pc, k, up ) ) == K.sAdjacent( c, k, up )
+                && P.unpack( Packer::uIncident( uc, k, up ) ) == K.uIncident( K.unsigns( c ), k, up )
+                && P.unpack( Packer::uAdjacent( uc, k, up ) ) == K.uAdjacent( K.unsigns( c ), k, up );
+          for ( auto q = K.sDirs( c ); q != 0; ++q )
+            ok = ok
+              && P.unpack( Packer::sDirectIncident( pc, *q ) ) == K.sDirectIncident( c, *q )
+              && P.unpack( Packer::sIndirectIncident( pc, *q ) ) == K.sIndirectIncident( c, *q );
+          if ( K.sDim( c ) == 2 )
+            ok = ok && Packer::sOrthDir( pc ) == K.sOrthDir( c );
+          nb += ok ? 1 : 0;
+        }
+      REQUIRE( nb == cells.size() );
+    }
+  }
+}
+
+SCENARIO( "KhalimskyCellPacker3D< KSpace > surfel sets", "[packer][surfels]" )
+{
+  typedef KhalimskyCellPacker3D< KSpace > Packer;
+  Point p1( -6, -6, -6 );
+  Point p2(  6,  6,  6 );
+  KSpace K;
+  K.init( p1, p2, true );
+  Packer P( K );
+  DigitalSet aSet( Domain( p1, p2 ) );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( 0, 0, 0 ), 4 );
+  DigitalSetBoundary< KSpace, DigitalSet > boundary( K, aSet );
+  Packer::SurfelSet surfels;
+  for ( auto s : boundary ) surfels.insert( P.pack( s ) );
+  GIVEN( "The boundary of a ball as a set of packed surfels" ) {
+    THEN( "The set has the same surfels as the boundary" ) {
+      REQUIRE( surfels.size() == boundary.nbSurfels() );
+      unsigned int nb = 0;
+      for ( auto s : boundary )
+        nb += surfels.count( P.pack( s ) );
+      REQUIRE( nb == boundary.nbSurfels() );
+    }
+    THEN( "Surfels of opposite orientation are not in the set" ) {
+      unsigned int nb = 0;
+      for ( auto s : boundary )
+        nb += surfels.count( Packer::sOpp( P.pack( s ) ) );
+      REQUIRE( nb == 0 );
+    }
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
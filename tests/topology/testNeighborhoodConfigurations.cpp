@@ -35,6 +35,10 @@
 #include "DGtal/shapes/Shapes.h"
 #include "DGtal/base/Common.h"
 #include "DGtal/topology/NeighborhoodConfigurations.h"
+#include "DGtal/topology/BitPackedOccupancy.h"
+#include "DGtal/topology/NeighborhoodConfigurationScanner.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/SimpleThresholdForegroundPredicate.h"
 #include "DGtal/topology/tables/NeighborhoodTables.h"
 using namespace std;
 using namespace DGtal;
@@ -298,6 +302,153 @@ TEST_CASE_METHOD(Objects2D, "Simplicity tables match on-the-fly calculations for
   }
 }
 
+TEST_CASE("BitPackedOccupancy gives the same configurations as Object in 3D", "[simple][packed][3D]" )
+{
+  using namespace Z3i;
+  auto mapZeroNeighborhoodToMask = mapZeroPointNeighborhoodToConfigurationMask<Point>();
+  Domain domain( Point( -4, -3, -5 ), Point( 70, 4, 3 ) );
+  DigitalSet aSet( domain );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( 0, 0, 0 ), 4 );
+  Shapes<Domain>::addNorm1Ball( aSet, Point( 62, 1, 0 ), 8 );
+  Shapes<Domain>::addNorm1Ball( aSet, Point( 30, 0, -1 ), 5 );
+  Object26_6 obj( dt26_6, aSet );
+  BitPackedOccupancy< Space > occupancy( domain.lowerBound(), domain.upperBound() );
+  occupancy.insert( aSet.begin(), aSet.end() );
+  std::vector< Point > points( domain.begin(), domain.end() );
+
+  SECTION("Occupancy and configurations of all points of the domain"){
+    std::vector< NeighborhoodConfiguration > configs;
+    occupancy.configurations( points, configs );
+    size_t nb_ok{0};
+    for ( size_t i = 0; i < points.size(); ++i )
+      if ( occupancy.test( points[ i ] ) == aSet( points[ i ] )
+           && configs[ i ] == obj.getNeighborhoodConfigurationOccupancy
+           ( points[ i ], *mapZeroNeighborhoodToMask ) )
+        ++nb_ok;
+    CHECK( nb_ok == points.size() );
+  }
+  SECTION("Batch isSimple of Object with a table"){
+    std::vector< Point > objPoints( aSet.begin(), aSet.end() );
+    std::vector< bool > simple;
+    obj.isSimple( objPoints, simple );
+    size_t nb_ok{0};
+    for ( size_t i = 0; i < objPoints.size(); ++i )
+      if ( simple[ i ] == obj.isSimple( objPoints[ i ] ) ) ++nb_ok;
+    CHECK( nb_ok == objPoints.size() );
+    obj.setTable( loadTable( simplicity::tableSimple26_6 ) );
+    std::vector< bool > simple_from_table;
+    obj.isSimple( objPoints, simple_from_table );
+    CHECK( simple == simple_from_table );
+  }
+}
+
+TEST_CASE_METHOD(Objects2D, "BitPackedOccupancy gives the same configurations as Object in 2D", "[simple][packed][2D]" )
+{
+  using namespace Z2i;
+  auto mapZeroNeighborhoodToMask = mapZeroPointNeighborhoodToConfigurationMask<Point>();
+  const auto & domain = obj8_4.domain();
+  BitPackedOccupancy< Space > occupancy( domain.lowerBound(), domain.upperBound() );
+  occupancy.insert( obj8_4.pointSet().begin(), obj8_4.pointSet().end() );
+  std::vector< Point > points( domain.begin(), domain.end() );
+  std::vector< NeighborhoodConfiguration > configs;
+  occupancy.configurations( points, configs );
+  size_t nb_ok{0};
+  for ( size_t i = 0; i < points.size(); ++i )
+    if ( configs[ i ] == obj8_4.getNeighborhoodConfigurationOccupancy
+         ( points[ i ], *mapZeroNeighborhoodToMask ) )
+      ++nb_ok;
+  CHECK( nb_ok == points.size() );
+  std::vector< Point > objPoints( obj4_8.pointSet().begin(), obj4_8.pointSet().end() );
+  std::vector< bool > simple;
+  obj4_8.isSimple( objPoints, simple );
+  obj4_8.setTable( loadTable<2>( simplicity::tableSimple4_8 ) );
+  std::vector< bool > simple_from_table;
+  obj4_8.isSimple( objPoints, simple_from_table );
+  CHECK( simple == simple_from_table );
+}
+
+TEST_CASE("NeighborhoodConfigurationScanner gives the same configurations as Object in 3D", "[scanner][3D]" )
+{
+  using namespace Z3i;
+  auto mapZeroNeighborhoodToMask = mapZeroPointNeighborhoodToConfigurationMask<Point>();
+  Domain domain( Point( -4, -3, -5 ), Point( 70, 4, 3 ) );
+  DigitalSet aSet( domain );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( 0, 0, 0 ), 4 );
+  Shapes<Domain>::addNorm1Ball( aSet, Point( 62, 1, 0 ), 8 );
+  Shapes<Domain>::addNorm1Ball( aSet, Point( 30, 0, -1 ), 5 );
+  Object26_6 obj( dt26_6, aSet );
+  std::vector< Point > points( domain.begin(), domain.end() );
+
+  SECTION("Iterating over the points of the domain with a digital set"){
+    typedef NeighborhoodConfigurationScanner< Space, DigitalSet > Scanner;
+    Scanner scanner( aSet, domain.lowerBound(), domain.upperBound() );
+    REQUIRE( scanner.size() == domain.size() );
+    size_t i{0}, nb_ok{0};
+    for ( Scanner::ConstIterator it = scanner.begin(), itE = scanner.end();
+          it != itE; ++it, ++i )
+      if ( i < points.size() && it.point() == points[ i ]
+           && it.isOccupied() == aSet( points[ i ] )
+           && *it == obj.getNeighborhoodConfigurationOccupancy
+           ( points[ i ], *mapZeroNeighborhoodToMask ) )
+        ++nb_ok;
+    CHECK( i == points.size() );
+    CHECK( nb_ok == points.size() );
+  }
+  SECTION("Batch configurations and simple points of a thresholded image"){
+    typedef ImageContainerBySTLVector< Domain, unsigned char > Image;
+    typedef functors::SimpleThresholdForegroundPredicate< Image > Predicate;
+    Image image( domain );
+    for ( auto p : domain ) image.setValue( p, aSet( p ) ? 2 : ( p[ 0 ] % 3 == 0 ) );
+    Predicate predicate( image, 1 );
+    NeighborhoodConfigurationScanner< Space, Predicate >
+      scanner( predicate, domain.lowerBound(), domain.upperBound() );
+    std::vector< NeighborhoodConfiguration > configs;
+    scanner.configurations( configs );
+    REQUIRE( configs.size() == points.size() );
+    size_t nb_ok{0};
+    for ( size_t i = 0; i < points.size(); ++i )
+      if ( configs[ i ] == obj.getNeighborhoodConfigurationOccupancy
+           ( points[ i ], *mapZeroNeighborhoodToMask ) )
+        ++nb_ok;
+    CHECK( nb_ok == points.size() );
+    auto table = loadTable( simplicity::tableSimple26_6 );
+    std::vector< Point > simplePoints;
+    scanner.selectPoints( *table, simplePoints );
+    std::vector< Point > expected;
+    for ( auto p : points )
+      if ( aSet( p ) && obj.isSimple( p ) ) expected.push_back( p );
+    CHECK( ! expected.empty() );
+    CHECK( simplePoints == expected );
+  }
+}
+
+TEST_CASE_METHOD(Objects2D, "NeighborhoodConfigurationScanner gives the same configurations as Object in 2D", "[scanner][2D]" )
+{
+  using namespace Z2i;
+  typedef NeighborhoodConfigurationScanner< Space, DigitalSet > Scanner;
+  auto mapZeroNeighborhoodToMask = mapZeroPointNeighborhoodToConfigurationMask<Point>();
+  const auto & domain = obj8_4.domain();
+  Scanner scanner( obj8_4.pointSet(), domain.lowerBound(), domain.upperBound() );
+  std::vector< Point > points( domain.begin(), domain.end() );
+  std::vector< NeighborhoodConfiguration > configs;
+  scanner.configurations( configs );
+  REQUIRE( configs.size() == points.size() );
+  size_t nb_ok{0};
+  for ( size_t i = 0; i < points.size(); ++i )
+    if ( configs[ i ] == obj8_4.getNeighborhoodConfigurationOccupancy
+         ( points[ i ], *mapZeroNeighborhoodToMask ) )
+      ++nb_ok;
+  CHECK( nb_ok == points.size() );
+  std::vector< NeighborhoodConfiguration > iterated( scanner.begin(), scanner.end() );
+  CHECK( iterated == configs );
+  std::vector< Point > simplePoints;
+  scanner.selectPoints( *loadTable<2>( simplicity::tableSimple8_4 ), simplePoints );
+  std::vector< Point > expected;
+  for ( auto p : points )
+    if ( obj8_4.pointSet()( p ) && obj8_4.isSimple( p ) ) expected.push_back( p );
+  CHECK( simplePoints == expected );
+}
+
 SCENARIO( "Load isthmus tables", "[isthmus]" ){
   SECTION("isthmus"){
     const auto & filename = isthmusicity::tableIsthmus;
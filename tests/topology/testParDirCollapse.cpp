@@ -41,6 +41,9 @@
 #include "DGtal/shapes/Shapes.h"
 #include "DGtal/shapes/EuclideanShapesDecorator.h"
 #include "DGtal/shapes/parametric/Flower2D.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -103,6 +106,28 @@ TEST_CASE( "Testing ParDirCollapse" )
       thinning.collapseIsthmus ();
       REQUIRE( (eulerBefore == complex.euler()) );
     }
+  SECTION("Testing that ParDirCollapse is deterministic")
+    {
+      getComplex< CC, KSpace > ( complex, K );
+      CC other ( K );
+      getComplex< CC, KSpace > ( other, K );
+      ParDirCollapse < CC > other_thinning ( K );
+      thinning.attach ( &complex );
+      other_thinning.attach ( &other );
+#ifdef WITH_OPENMP
+      const int nb_threads = omp_get_max_threads();
+      omp_set_num_threads( 1 );
+#endif
+      const unsigned int removed = thinning.eval ( 2 );
+      thinning.collapseIsthmus ();
+#ifdef WITH_OPENMP
+      omp_set_num_threads( nb_threads );
+#endif
+      REQUIRE( removed == other_thinning.eval ( 2 ) );
+      other_thinning.collapseIsthmus ();
+      REQUIRE( complex.size() == other.size() );
+      REQUIRE( complex == other );
+    }
 }
 
 /** @ingroup Tests **/
@@ -315,6 +315,65 @@ bool testFindABel()
 }
 
 
+/**
+* Checks that Surfaces::uMakeSortedBoundary and
+* Surfaces::sMakeSortedBoundary give exactly the (ordered) cells of
+* Surfaces::uMakeBoundary and Surfaces::sMakeBoundary.
+*/
+template <typename KSpace>
+bool testMakeSortedBoundary()
+{
+  typedef typename KSpace::Space     Space;
+  typedef typename KSpace::Point     Point;
+  typedef typename KSpace::Cell      Cell;
+  typedef typename KSpace::SCell     SCell;
+  typedef HyperRectDomain<Space>     Domain;
+  typedef DigitalSetBySTLSet<Domain> DigitalSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing Surfaces::uMakeSortedBoundary and Surfaces::sMakeSortedBoundary." );
+  Point p1 = Point::diagonal( -7 );
+  Point p2 = Point::diagonal(  6 );
+  KSpace K; K.init( p1, p2, true );
+  Domain domain( p1, p2 );
+  DigitalSet aSet( domain );
+  Shapes<Domain>::addNorm2Ball( aSet, Point::zero, 5 );
+  Shapes<Domain>::removeNorm2Ball( aSet, Point::zero, 2 );
+  aSet.insert( p1 );
+  aSet.insert( p2 );
+  std::set<Cell>  ubdry;
+  std::set<SCell> sbdry;
+  Surfaces<KSpace>::uMakeBoundary( ubdry, K, aSet, K.lowerBound(), K.upperBound() );
+  Surfaces<KSpace>::sMakeBoundary( sbdry, K, aSet, K.lowerBound(), K.upperBound() );
+  std::vector<Cell>  usorted;
+  std::vector<SCell> ssorted;
+  Surfaces<KSpace>::uMakeSortedBoundary( usorted, K, aSet, K.lowerBound(), K.upperBound() );
+  Surfaces<KSpace>::sMakeSortedBoundary( ssorted, K, aSet, K.lowerBound(), K.upperBound() );
+  trace.info() << "#ubdry=" << ubdry.size() << " #usorted=" << usorted.size()
+               << " #sbdry=" << sbdry.size() << " #ssorted=" << ssorted.size() << std::endl;
+  ++nb; nbok += ( ! ubdry.empty() && ubdry.size() == usorted.size()
+                  && std::equal( ubdry.begin(), ubdry.end(), usorted.begin() ) ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << " unsigned sorted boundary == unsigned boundary set" << std::endl;
+  ++nb; nbok += ( ! sbdry.empty() && sbdry.size() == ssorted.size()
+                  && std::equal( sbdry.begin(), sbdry.end(), ssorted.begin() ) ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << " signed sorted boundary == signed boundary set" << std::endl;
+  // Sub-domain extraction.
+  Point q1 = Point::diagonal( -3 );
+  Point q2 = Point::diagonal(  1 );
+  sbdry.clear();
+  Surfaces<KSpace>::sMakeBoundary( sbdry, K, aSet, q1, q2 );
+  Surfaces<KSpace>::sMakeSortedBoundary( ssorted, K, aSet, q1, q2 );
+  ++nb; nbok += ( ! sbdry.empty() && sbdry.size() == ssorted.size()
+                  && std::equal( sbdry.begin(), sbdry.end(), ssorted.begin() ) ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << " signed sorted boundary == signed boundary set in sub-domain" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -327,7 +386,9 @@ int main( int argc, char** argv )
   trace.info() << endl;
 
   bool res = testComputeInterior()
-    && testFindABel< KhalimskySpaceND<3,int> >()  && test3dSurfaceHelper();
+    && testFindABel< KhalimskySpaceND<3,int> >()  && test3dSurfaceHelper()
+    && testMakeSortedBoundary< KhalimskySpaceND<2,int> >()
+    && testMakeSortedBoundary< KhalimskySpaceND<3,int> >();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
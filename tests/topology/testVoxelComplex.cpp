@@ -36,8 +36,12 @@
 #include "DGtal/topology/VoxelComplex.h"
 #include "DGtal/topology/VoxelComplexFunctions.h"
 #include "DGtalCatch.h"
+#include <algorithm>
 #include <iostream>
 #include <unordered_map>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
 
 #include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
 #include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
@@ -336,6 +340,20 @@ TEST_CASE_METHOD(Fixture_complex_diamond, "Test table wrappers",
         size_t border_size = 44;
         REQUIRE(nsimples == border_size);
     }
+    SECTION("batch querying of voxel simplicity") {
+        std::vector<FixtureComplex::Cell> spels;
+        for (auto it = vc.begin(dim_voxel); it != vc.end(dim_voxel); ++it)
+            spels.push_back(it->first);
+        std::vector<bool> simple;
+        vc.isSimple(spels, simple);
+        REQUIRE(simple.size() == spels.size());
+        size_t nsimples{0};
+        for (std::size_t i = 0; i < spels.size(); ++i) {
+            CHECK(simple[i] == vc.isSimple(spels[i]));
+            if (simple[i]) ++nsimples;
+        }
+        REQUIRE(nsimples == 44);
+    }
 }
 
 TEST_CASE_METHOD(Fixture_complex_diamond, "Cliques Masks K_2", "[clique]") {
@@ -441,6 +459,32 @@ TEST_CASE_METHOD(Fixture_complex_diamond, "Get All Critical Cliques of diamond",
     }
 }
 
+TEST_CASE_METHOD(Fixture_complex_diamond,
+                 "Critical cliques are given in the order of cells",
+                 "[critical][clique][parallel]") {
+    auto &vc = complex_fixture;
+    for (Dimension d = 0; d <= 3; ++d) {
+        FixtureComplex::CliqueContainer expected;
+        for (auto it = vc.begin(d), itE = vc.end(d); it != itE; ++it) {
+            auto clique_p = vc.criticalCliquePair(d, it);
+            if (clique_p.first)
+                expected.push_back(clique_p.second);
+        }
+        auto critical = vc.criticalCliquesForD(d, vc);
+        REQUIRE(critical.size() == expected.size());
+        CHECK(std::equal(critical.begin(), critical.end(), expected.begin()));
+#ifdef WITH_OPENMP
+        const int nb_threads = omp_get_max_threads();
+        omp_set_num_threads(1);
+        auto critical_1 = vc.criticalCliquesForD(d, vc);
+        omp_set_num_threads(nb_threads);
+        REQUIRE(critical_1.size() == critical.size());
+        CHECK(std::equal(critical_1.begin(), critical_1.end(),
+                         critical.begin()));
+#endif
+    }
+}
+
 
 ///////////////////////////////////////////////////////////////////////////
 // Fixture for complex fig 4 of Asymmetric parallel 3D thinning scheme
@@ -807,6 +851,34 @@ TEST_CASE_METHOD(Fixture_isthmus, "Thin complex", "[isthmus][thin][function]") {
     }
 }
 //
+TEST_CASE_METHOD(Fixture_isthmus, "Thin complex is deterministic",
+                 "[isthmus][thin][function][parallel]") {
+    using namespace DGtal::functions;
+    auto &vc = complex_fixture;
+    auto thin = [&vc]() {
+        return asymetricThinningScheme<FixtureComplex>(
+            vc, selectFirst<FixtureComplex>, skelIsthmus<FixtureComplex>);
+    };
+    auto persistence_thin = [&vc]() {
+        return persistenceAsymetricThinningScheme<FixtureComplex>(
+            vc, selectFirst<FixtureComplex>, skelEnd<FixtureComplex>, 1);
+    };
+    auto vc_thin = thin();
+    auto vc_persistence = persistence_thin();
+    CHECK(vc_thin.nbCells(3) == 3);
+    CHECK(vc_thin == thin());
+    CHECK(vc_persistence == persistence_thin());
+#ifdef WITH_OPENMP
+    const int nb_threads = omp_get_max_threads();
+    omp_set_num_threads(1);
+    auto vc_thin_1 = thin();
+    auto vc_persistence_1 = persistence_thin();
+    omp_set_num_threads(nb_threads);
+    CHECK(vc_thin == vc_thin_1);
+    CHECK(vc_persistence == vc_persistence_1);
+#endif
+}
+//
 TEST_CASE_METHOD(Fixture_isthmus, "Persistence thin",
                  "[persistence][isthmus][thin][function]") {
     using namespace DGtal::functions;
@@ -1055,6 +1127,46 @@ TEST_CASE_METHOD(Fixture_X, "X Thin with Isthmus, and tables",
     }
 }
 
+TEST_CASE_METHOD(Fixture_X, "X distance ordered skeleton",
+                 "[x][distance][thin][function][table]") {
+    using namespace DGtal::functions;
+    auto &vc = complex_fixture;
+    using Predicate = Z3i::DigitalSet;
+    using L2Metric = ExactPredicateLpSeparableMetric<Z3i::Space, 2>;
+    using DT = DistanceTransformation<Z3i::Space, Predicate, L2Metric>;
+    L2Metric l2;
+    DT dt(set_fixture.domain(), set_fixture, l2);
+    SECTION("A simplicity table is required") {
+        boost::dynamic_bitset<> empty_table(1 << 26);
+        CHECK_THROWS(distanceOrderedSkeleton(vc, empty_table, dt));
+    }
+    vc.setSimplicityTable(functions::loadTable(simplicity::tableSimple26_6));
+    SECTION("Ultimate skeleton with an empty table") {
+        boost::dynamic_bitset<> empty_table(1 << 26);
+        auto vc_new = distanceOrderedSkeleton(vc, empty_table, dt);
+        CHECK(vc_new.nbCells(3) == 1);
+        CHECK(vc_new.euler() == vc.euler());
+    }
+    SECTION("Curve skeleton with the one isthmus table") {
+        auto table = *functions::loadTable(isthmusicity::tableOneIsthmus);
+        auto vc_new = distanceOrderedSkeleton(vc, table, dt);
+        CHECK(vc_new.nbCells(3) > 1);
+        CHECK(vc_new.nbCells(3) < vc.nbCells(3));
+        CHECK(vc_new.euler() == vc.euler());
+        CHECK(vc_new <= vc);
+        CHECK(vc_new == distanceOrderedSkeleton(vc, table, dt));
+        // Only the ends of the branches of the X are simple.
+        std::size_t nb_simple = 0, nb_simple_ends = 0;
+        for (auto it = vc_new.begin(3), itE = vc_new.end(3); it != itE; ++it)
+            if (vc_new.isSimple(it->first)) {
+                ++nb_simple;
+                nb_simple_ends += skelEnd(vc_new, it->first) ? 1 : 0;
+            }
+        CHECK(nb_simple == 4);
+        CHECK(nb_simple_ends == nb_simple);
+    }
+}
+
 /// Use distance map in the Select function.
 TEST_CASE_METHOD(Fixture_X, "X DistanceMap", "[x][distance][thin]") {
     using namespace DGtal::functions;